@@ -1,5 +1,16 @@
 #include "BaseTelegraphAbility.h"
 #include "GameFramework/Character.h"
+#include "EnemyCharacter.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "NeonGameplayTags.h"
+#include "NeonCombatStats.h"
+#include "NeonEffectLibrary.h"
+#include "NeonAssetPreloadSubsystem.h"
+#include "NeonCombatLog.h"
+#include "NeonProjectile.h"
+#include "NeonProjectilePoolSubsystem.h"
+#include "GameFramework/PlayerState.h"
 
 /**
  * Constructor - Required by Unreal's reflection system even if empty
@@ -9,63 +20,236 @@ UBaseTelegraphAbility::UBaseTelegraphAbility()
 }
 
 /**
- * Spawns a telegraph actor at the owner's location with forward offset.
- * The telegraph is attached to the owner and will move with them.
+ * Lists the soft telegraph references so a character's manifest can stream them before the first cast.
+ */
+void UBaseTelegraphAbility::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	if (!DefaultTelegraphClass.IsNull())
+	{
+		OutAssets.AddUnique(DefaultTelegraphClass.ToSoftObjectPath());
+	}
+
+	if (!TelegraphMesh.IsNull())
+	{
+		OutAssets.AddUnique(TelegraphMesh.ToSoftObjectPath());
+	}
+
+	if (!TelegraphMaterial.IsNull())
+	{
+		OutAssets.AddUnique(TelegraphMaterial.ToSoftObjectPath());
+	}
+}
+
+/**
+ * Shows a telegraph at the owner's location with forward offset.
+ * The telegraph subsystem moves it with the owner every frame.
  */
 void UBaseTelegraphAbility::StartTelegraph(TSubclassOf<AActor> TelegraphClassOverride)
 {
+	NEON_COMBAT_SCOPE(STAT_NeonTelegraphStart);
+
 	// Early exit if a telegraph is already active to prevent duplicates
-	if (ActiveTelegraph)
+	if (ActiveTelegraph.IsValid())
 	{
 		return;
 	}
 
 	// Get the character/pawn that owns this ability
 	AActor* Avatar = GetAvatarActorFromActorInfo();
+
+	// An enemy winding up an attack is fighting - keep it at full update rate
+	if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Avatar))
+	{
+		Enemy->NotifyCombatActivity();
+	}
 	
-	// Determine which class to spawn (override takes priority)
-	TSubclassOf<AActor> ClassToSpawn = TelegraphClassOverride ? TelegraphClassOverride : DefaultTelegraphClass;
+	UWorld* World = GetWorld();
+	UNeonTelegraphSubsystem* Telegraphs = World ? World->GetSubsystem<UNeonTelegraphSubsystem>() : nullptr;
 
-	// Validate we have both an owner and a class to spawn
-	if (Avatar && ClassToSpawn)
+	// Determine what to show (override takes priority, then the instanced mesh, then the default class).
+	// Unloaded soft references resolve to null and start streaming instead of blocking the game thread.
+	FNeonTelegraphVisual Visual;
+	if (TelegraphClassOverride)
 	{
-		// Calculate spawn position: owner's location, slightly below ground, offset forward
-		FVector SpawnLoc = Avatar->GetActorLocation();
-		SpawnLoc.Z -= 80.0f; // Lower to ground level (adjust as needed for your game)
-		SpawnLoc += Avatar->GetActorForwardVector() * TelegraphForwardOffset;
+		Visual.ActorClass = TelegraphClassOverride;
+	}
+	else
+	{
+		Visual.Mesh = UNeonAssetPreloadSubsystem::ResolveObject(this, TelegraphMesh);
+		Visual.Material = UNeonAssetPreloadSubsystem::ResolveObject(this, TelegraphMaterial);
 
-		// Use owner's rotation for the telegraph
-		FRotator SpawnRot = Avatar->GetActorRotation();
+		// Don't draw the mesh with the wrong material while the override is still streaming
+		if (!Visual.Material && !TelegraphMaterial.IsNull())
+		{
+			Visual.Mesh = nullptr;
+		}
 
-		// Configure spawn parameters
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = Avatar;
+		if (!Visual.Mesh)
+		{
+			Visual.ActorClass = UNeonAssetPreloadSubsystem::ResolveClass(this, DefaultTelegraphClass);
+		}
 
-		// Spawn the telegraph actor
-		ActiveTelegraph = GetWorld()->SpawnActor<AActor>(ClassToSpawn, SpawnLoc, SpawnRot, SpawnParams);
-        
-		if (ActiveTelegraph)
+		if (!Visual.IsSet() && (!TelegraphMesh.IsNull() || !DefaultTelegraphClass.IsNull()))
 		{
-			// Attach to owner so it follows their movement
-			ActiveTelegraph->AttachToComponent(
-				Avatar->GetRootComponent(), 
-				FAttachmentTransformRules::KeepWorldTransform
-			);
-			
-			// Apply configured scale
-			ActiveTelegraph->SetActorScale3D(TelegraphScale);
+			NEON_COMBAT_VERBOSE(TEXT("%s: telegraph assets still streaming - skipping telegraph"), *GetName());
 		}
 	}
+
+	// Validate we have both an owner and something to show
+	if (Avatar && Telegraphs && Visual.IsSet())
+	{
+		// Relative to the owner: slightly below ground, offset forward, owner's rotation
+		const FVector Offset(TelegraphForwardOffset, 0.0f, -80.0f); // Lower to ground level (adjust as needed for your game)
+		const FTransform RelativeTransform(FQuat::Identity, Offset, TelegraphScale);
+
+		ActiveTelegraph = Telegraphs->AcquireTelegraph(Visual, Avatar, RelativeTransform);
+	}
 }
 
 /**
- * Destroys the active telegraph actor and clears the reference.
+ * Returns the active telegraph to the pool and clears the handle.
  */
 void UBaseTelegraphAbility::StopTelegraph()
 {
-	if (ActiveTelegraph)
+	NEON_COMBAT_SCOPE(STAT_NeonTelegraphStop);
+
+	if (!ActiveTelegraph.IsValid())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (UNeonTelegraphSubsystem* Telegraphs = World ? World->GetSubsystem<UNeonTelegraphSubsystem>() : nullptr)
+	{
+		Telegraphs->ReleaseTelegraph(ActiveTelegraph);
+	}
+
+	ActiveTelegraph.Reset();
+}
+
+/**
+ * Builds a damage spec at the ability's level and fills in the native damage tags.
+ */
+FGameplayEffectSpecHandle UBaseTelegraphAbility::MakeDamageEffectSpec(
+	TSubclassOf<UGameplayEffect> DamageEffectClass, 
+	float Damage, 
+	bool bNeonDamage) const
+{
+	FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(DamageEffectClass, GetAbilityLevel());
+
+	if (SpecHandle.IsValid())
 	{
-		ActiveTelegraph->Destroy();
-		ActiveTelegraph = nullptr;
+		SpecHandle.Data->SetSetByCallerMagnitude(NeonGameplayTags::Data_Damage, Damage);
+
+		if (bNeonDamage)
+		{
+			SpecHandle.Data->AddDynamicAssetTag(NeonGameplayTags::Damage_Type_Neon);
+		}
 	}
+
+	return SpecHandle;
+}
+
+/**
+ * Builds the damage spec once and applies it to all targets through UNeonEffectLibrary.
+ */
+int32 UBaseTelegraphAbility::ApplyDamageToTargets(
+	TSubclassOf<UGameplayEffect> DamageEffectClass, 
+	const TArray<AActor*>& TargetActors, 
+	float Damage, 
+	bool bNeonDamage) const
+{
+	if (TargetActors.Num() == 0)
+	{
+		return 0;
+	}
+
+	return UNeonEffectLibrary::ApplyEffectSpecToActors(MakeDamageEffectSpec(DamageEffectClass, Damage, bNeonDamage), TargetActors);
+}
+
+/**
+ * The spec is built at cast time (the ability may have ended by the time the overlap completes)
+ * and shared by every target; only Data.Falloff changes per target.
+ */
+bool UBaseTelegraphAbility::ApplyAoeDamage(
+	TSubclassOf<UGameplayEffect> DamageEffectClass, 
+	const FNeonAoeShape& Shape, 
+	float Damage, 
+	bool bNeonDamage) const
+{
+	UWorld* World = GetWorld();
+	UNeonAoeSubsystem* AoeSubsystem = World ? World->GetSubsystem<UNeonAoeSubsystem>() : nullptr;
+	if (!AoeSubsystem)
+	{
+		return false;
+	}
+
+	const FGameplayEffectSpecHandle SpecHandle = MakeDamageEffectSpec(DamageEffectClass, Damage, bNeonDamage);
+	if (!SpecHandle.IsValid())
+	{
+		return false;
+	}
+
+	const FNeonAoeRequestHandle Request = AoeSubsystem->RequestAoe(Shape, GetAvatarActorFromActorInfo(), FNeonAoeResolvedDelegate::CreateLambda(
+		[SpecHandle](TArrayView<const FNeonAoeTarget> Targets)
+		{
+			TArray<UAbilitySystemComponent*, TInlineAllocator<32>> TargetASCs;
+			TArray<float, TInlineAllocator<32>> Scales;
+			for (const FNeonAoeTarget& Target : Targets)
+			{
+				TargetASCs.Add(Target.AbilitySystem);
+				Scales.Add(Target.Falloff);
+			}
+
+			UNeonEffectLibrary::ApplyEffectSpecToTargetsScaled(SpecHandle, TargetASCs, Scales);
+		}));
+
+	return Request.IsValid();
+}
+
+/**
+ * Server and predicting client fire the same pooled projectile; the activation prediction key ties them together.
+ * The server starts its flight half a round trip in, where the client's stand-in already is.
+ */
+ANeonProjectile* UBaseTelegraphAbility::FireBoomerang(
+	TSubclassOf<ANeonProjectile> ProjectileClass, 
+	const FTransform& LaunchTransform, 
+	float MaxDistance)
+{
+	AActor* Avatar = GetAvatarActorFromActorInfo();
+	UWorld* World = GetWorld();
+	UNeonProjectilePoolSubsystem* Pool = World ? World->GetSubsystem<UNeonProjectilePoolSubsystem>() : nullptr;
+	if (!Avatar || !Pool || !ProjectileClass)
+	{
+		return nullptr;
+	}
+
+	const FGameplayAbilityActivationInfo& ActivationInfo = GetCurrentActivationInfo();
+	const FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+	const bool bAuthority = HasAuthority(&ActivationInfo);
+
+	// Other clients only ever see the server's projectile
+	if (!bAuthority && !IsPredictingClient())
+	{
+		return nullptr;
+	}
+
+	APawn* AvatarPawn = Cast<APawn>(Avatar);
+
+	float ForwardPredictTime = 0.f;
+	if (bAuthority && PredictionKey.IsValidKey() && !IsLocallyControlled())
+	{
+		if (const APlayerState* PlayerState = AvatarPawn ? AvatarPawn->GetPlayerState() : nullptr)
+		{
+			ForwardPredictTime = FMath::Min(PlayerState->GetPingInMilliseconds() * 0.0005f, MaxForwardPredictTime);
+		}
+	}
+
+	ANeonProjectile* Projectile = Pool->AcquireProjectile(ProjectileClass, LaunchTransform, Avatar, AvatarPawn);
+	if (Projectile)
+	{
+		Projectile->LaunchBoomerang(Avatar, MaxDistance, PredictionKey, ForwardPredictTime);
+	}
+
+	return Projectile;
 }
\ No newline at end of file
@@ -2,11 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
+#include "NeonAoeSubsystem.h"
+#include "NeonTelegraphSubsystem.h"
 #include "BaseTelegraphAbility.generated.h"
 
+// Forward declarations
+class ANeonProjectile;
+
 /**
  * Base class for abilities that display a telegraph (visual indicator) before executing.
- * This class manages spawning and destroying telegraph actors during ability execution.
+ * This class shows and hides telegraphs through UNeonTelegraphSubsystem during ability execution.
  * Designed to be used with Blueprint child classes that control the actual ability flow.
  */
 UCLASS()
@@ -17,36 +22,100 @@ class PROJECT_SUNSET_API UBaseTelegraphAbility : public UGameplayAbility
 public:
 	UBaseTelegraphAbility();
 
+	/** Adds the telegraph assets this ability shows to a preload list (see UNeonPreloadManifest) */
+	void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
 protected:
 	// ========================================
 	// Blueprint-Callable Functions
 	// ========================================
 	
 	/**
-	 * Spawns and attaches a telegraph actor to the ability owner.
+	 * Shows a telegraph that follows the ability owner.
 	 * Call this at the start of your ability animation/montage.
+	 * Never loads synchronously: if the telegraph assets aren't preloaded yet, nothing is shown and they start streaming.
 	 * 
-	 * @param TelegraphClassOverride - Optional class to spawn instead of DefaultTelegraphClass
+	 * @param TelegraphClassOverride - Optional actor class to show instead of TelegraphMesh/DefaultTelegraphClass
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Telegraph")
 	void StartTelegraph(TSubclassOf<AActor> TelegraphClassOverride = nullptr);
 
 	/**
-	 * Destroys the active telegraph actor.
+	 * Hides the active telegraph (returns it to the telegraph pool).
 	 * Call this when the ability hits, completes, or is cancelled.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Telegraph")
 	void StopTelegraph();
 
+	/**
+	 * Creates an outgoing damage spec for this ability with Data.Damage already set.
+	 * Uses the native tags from NeonGameplayTags, so no tag lookups happen per call.
+	 * 
+	 * @param DamageEffectClass - Effect to create (normally one using UNeonDamageExecCalculation)
+	 * @param Damage - Base damage (Data.Damage SetByCaller magnitude)
+	 * @param bNeonDamage - Adds Damage.Type.Neon to the spec so it can trigger the corruption combo
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Damage")
+	FGameplayEffectSpecHandle MakeDamageEffectSpec(TSubclassOf<UGameplayEffect> DamageEffectClass, float Damage, bool bNeonDamage = false) const;
+
+	/**
+	 * Deals damage to every target of a multi-target hit (slams, sweeps) with one shared spec.
+	 * 
+	 * @param DamageEffectClass - Effect to apply (normally one using UNeonDamageExecCalculation)
+	 * @param TargetActors - Actors hit; actors without an ASC are skipped
+	 * @param Damage - Base damage (Data.Damage SetByCaller magnitude)
+	 * @param bNeonDamage - Adds Damage.Type.Neon to the spec so it can trigger the corruption combo
+	 * @return Number of targets damaged
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Damage")
+	int32 ApplyDamageToTargets(TSubclassOf<UGameplayEffect> DamageEffectClass, const TArray<AActor*>& TargetActors, float Damage, bool bNeonDamage = false) const;
+
+	/**
+	 * Deals area damage (ultimate slam, shockwaves) through UNeonAoeSubsystem.
+	 * Targets are resolved asynchronously; damage lands once the overlap completes and is scaled by the shape's falloff.
+	 * 
+	 * @param DamageEffectClass - Effect to apply (normally one using UNeonDamageExecCalculation)
+	 * @param Shape - Area to hit; the avatar is never hit by its own AOE
+	 * @param Damage - Base damage at the center (Data.Damage SetByCaller magnitude)
+	 * @param bNeonDamage - Adds Damage.Type.Neon to the spec so it can trigger the corruption combo
+	 * @return True if the request was issued
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Damage")
+	bool ApplyAoeDamage(TSubclassOf<UGameplayEffect> DamageEffectClass, const FNeonAoeShape& Shape, float Damage, bool bNeonDamage = false) const;
+
+	/**
+	 * Fires a pooled boomerang with client prediction.
+	 * The server fires the real projectile; a predicting client fires a local stand-in straight away,
+	 * which the server's projectile takes over once it replicates. Only the server applies effects.
+	 * 
+	 * @param ProjectileClass - Projectile to fire
+	 * @param LaunchTransform - Launch location and facing
+	 * @param MaxDistance - Outgoing distance before the boomerang returns
+	 * @return The projectile fired on this machine (nullptr on clients that aren't predicting this activation)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Projectile")
+	ANeonProjectile* FireBoomerang(TSubclassOf<ANeonProjectile> ProjectileClass, const FTransform& LaunchTransform, float MaxDistance = 1000.f);
+
 	// ========================================
 	// Configuration Properties
 	// ========================================
 	
 	/** Default telegraph actor class to spawn (e.g., a decal or mesh) */
 	UPROPERTY(EditDefaultsOnly, Category = "Telegraph")
-	TSubclassOf<AActor> DefaultTelegraphClass;
+	TSoftClassPtr<AActor> DefaultTelegraphClass;
 
-	/** Scale to apply to the spawned telegraph actor */
+	/**
+	 * Mesh drawn as the telegraph. Preferred over DefaultTelegraphClass: every telegraph
+	 * sharing a mesh/material is drawn by one instanced component.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Telegraph")
+	TSoftObjectPtr<UStaticMesh> TelegraphMesh;
+
+	/** Material override for TelegraphMesh */
+	UPROPERTY(EditDefaultsOnly, Category = "Telegraph")
+	TSoftObjectPtr<UMaterialInterface> TelegraphMaterial;
+
+	/** Scale to apply to the telegraph */
 	UPROPERTY(EditDefaultsOnly, Category = "Telegraph")
 	FVector TelegraphScale = FVector(1.0f, 1.0f, 1.0f);
 
@@ -54,8 +123,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Telegraph")
 	float TelegraphForwardOffset = 100.0f;
 
+	/**
+	 * Most the server advances a predicted projectile to catch up with the client's stand-in (seconds).
+	 * Higher pings are corrected on the client instead.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Projectile")
+	float MaxForwardPredictTime = 0.125f;
+
 private:
-	/** Reference to the currently active telegraph actor, if any */
-	UPROPERTY()
-	AActor* ActiveTelegraph;
+	/** Currently active telegraph, if any */
+	FNeonTelegraphHandle ActiveTelegraph;
 };
\ No newline at end of file
@@ -2,16 +2,22 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "NeonAttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "NeonCombatLog.h"
+#include "Components/SkeletalMeshComponent.h"
 
 /**
  * Constructor - Sets up basic enemy movement speed
  */
 AEnemyCharacter::AEnemyCharacter()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// No native per-frame work (inherits APlayerCharacter's disabled tick)
+	PrimaryActorTick.bCanEverTick = false;
 	
 	// Set enemy movement speed (slower than player's 300 base, 600 sprint)
 	GetCharacterMovement()->MaxWalkSpeed = 300.f;
+
+	// AI-controlled: nobody needs the enemy's active effects, only its tags and cues
+	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Minimal);
 }
 
 /**
@@ -31,28 +37,84 @@ void AEnemyCharacter::BeginPlay()
 		Attributes->InitHealth(100.0f);
 		Attributes->InitMaxHealth(100.0f);
 		Attributes->InitNeon(0.0f); // Enemies start with no Neon
+
+		// InitX writes the values directly, bypassing the push-model dirty marking
+		Attributes->MarkAllAttributesDirty();
+	}
+
+	if (GetMesh())
+	{
+		DefaultAnimTickOption = GetMesh()->VisibilityBasedAnimTickOption;
+	}
+
+	// Crowd LOD: update rates follow distance, visibility and combat
+	if (UNeonSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UNeonSignificanceSubsystem>())
+	{
+		Significance->RegisterEnemy(this);
 	}
     
-	UE_LOG(LogTemp, Warning, TEXT("EnemyCharacter BeginPlay complete"));
+	NEON_COMBAT_VERBOSE(TEXT("EnemyCharacter %s BeginPlay complete"), *GetName());
 }
 
 /**
- * Handles damage received by this enemy.
- * Filters out damage events meant for other actors, then triggers Blueprint event.
- * 
- * @param DamageAmount - Amount of damage received
- * @param DamagedActor - The actor that was damaged
+ * Removes the enemy from significance scoring.
  */
-void AEnemyCharacter::HandleDamageTaken(float DamageAmount, AActor* DamagedActor)
+void AEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Safety check: Only process damage if it's meant for this specific enemy
-	if (DamagedActor != this)
+	if (UNeonSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UNeonSignificanceSubsystem>())
 	{
-		return;
+		Significance->UnregisterEnemy(this);
 	}
-    
-	UE_LOG(LogTemp, Error, TEXT("EnemyCharacter: %s took %.1f damage!"), *GetName(), DamageAmount);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+/**
+ * Pushes the bucket's rates to every per-frame cost the enemy has.
+ * Only called on bucket changes, so the component calls here don't run every frame.
+ */
+void AEnemyCharacter::ApplySignificanceLOD(ENeonSignificanceLOD LOD, const FNeonSignificanceBucketSettings& Settings)
+{
+	SignificanceLOD = LOD;
+
+	SetActorTickInterval(Settings.ActorTickInterval);
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->SetComponentTickInterval(Settings.MovementTickInterval);
+	}
+
+	if (USkeletalMeshComponent* SkeletalMesh = GetMesh())
+	{
+		SkeletalMesh->SetComponentTickInterval(Settings.AnimationTickInterval);
+		SkeletalMesh->VisibilityBasedAnimTickOption = Settings.bOnlyAnimateWhenRendered
+			? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered
+			: DefaultAnimTickOption;
+	}
+
+	SetAttributeEventsDeferred(Settings.bDeferAttributeEvents);
+}
+
+/**
+ * Engaged enemies are promoted on the next scoring pass and stay at full rate for EngagedTime.
+ */
+void AEnemyCharacter::NotifyCombatActivity()
+{
+	LastCombatTime = GetWorld()->GetTimeSeconds();
+}
+
+/**
+ * Handles damage received by this enemy.
+ * The event comes from this enemy's own attribute set, so no target filtering is needed.
+ * 
+ * @param Event - The damage that was applied to this enemy
+ */
+void AEnemyCharacter::HandleDamageTaken(const FNeonDamageEvent& Event)
+{
+	NEON_COMBAT_VERBOSE(TEXT("EnemyCharacter: %s took %.1f damage!"), *GetName(), Event.Amount);
+
+	NotifyCombatActivity();
     
 	// Trigger Blueprint event for AI/animation reactions
-	DamageEvent(DamageAmount);
+	DamageEvent(Event.Amount);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include "CoreMinimal.h"
 #include "PlayerCharacter.h"
+#include "NeonSignificanceSubsystem.h"
+#include "Components/SkinnedMeshComponent.h"
 #include "EnemyCharacter.generated.h"
 
 /**
@@ -17,10 +19,32 @@ class PROJECT_SUNSET_API AEnemyCharacter : public APlayerCharacter
 public:
 	AEnemyCharacter();
 
+	// ========================================
+	// Significance
+	// ========================================
+
+	/** Bucket assigned by UNeonSignificanceSubsystem */
+	ENeonSignificanceLOD GetSignificanceLOD() const { return SignificanceLOD; }
+
+	/**
+	 * Applies a significance bucket's update rates to the actor, movement, mesh and attribute events.
+	 * Called by UNeonSignificanceSubsystem when the enemy changes bucket.
+	 */
+	void ApplySignificanceLOD(ENeonSignificanceLOD LOD, const FNeonSignificanceBucketSettings& Settings);
+
+	/** Marks the enemy as fighting (keeps it at full update rate for a while) */
+	void NotifyCombatActivity();
+
+	/** World time of the last hit taken or attack started */
+	double GetLastCombatTime() const { return LastCombatTime; }
+
 protected:
 	/** Called when the game starts or when spawned */
 	virtual void BeginPlay() override;
 
+	/** Called when the enemy is destroyed or the level ends */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/**
 	 * Blueprint event that fires when this enemy takes damage.
 	 * Implement in Blueprint to trigger animations, AI reactions, effects, etc.
@@ -32,10 +56,19 @@ protected:
 
 	/**
 	 * Overridden damage handler from parent class.
-	 * Filters damage to only affect this specific enemy, then triggers Blueprint event.
+	 * Marks the enemy as engaged, then triggers Blueprint event.
 	 * 
-	 * @param DamageAmount - The amount of damage received
-	 * @param DamagedActor - The actor that was damaged (should be this enemy)
+	 * @param Event - The damage that was applied to this enemy
 	 */
-	virtual void HandleDamageTaken(float DamageAmount, AActor* DamagedActor) override;
+	virtual void HandleDamageTaken(const FNeonDamageEvent& Event) override;
+
+private:
+	/** Current significance bucket */
+	ENeonSignificanceLOD SignificanceLOD = ENeonSignificanceLOD::High;
+
+	/** World time of the last hit taken or attack started */
+	double LastCombatTime = -UE_BIG_NUMBER;
+
+	/** Mesh's own anim tick option, restored when leaving a bucket that only animates on screen */
+	EVisibilityBasedAnimTickOption DefaultAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPose;
 };
\ No newline at end of file
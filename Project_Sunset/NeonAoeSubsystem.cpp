@@ -0,0 +1,361 @@
+#include "NeonAoeSubsystem.h"
+#include "NeonCombatPawnRegistry.h"
+#include "NeonEffectLibrary.h"
+#include "NeonCombatStats.h"
+#include "PlayerCharacter.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "Engine/World.h"
+#include "Math/VectorRegister.h"
+
+/** Lanes per vector register */
+static constexpr int32 FalloffWidth = 4;
+
+// ========================================
+// Requests
+// ========================================
+
+/**
+ * Issues the async overlap for the shape's bounding volume.
+ * Cones and rings use their bounding sphere; the exact test happens when the results come back.
+ */
+FNeonAoeRequestHandle UNeonAoeSubsystem::RequestAoe(const FNeonAoeShape& Shape, const AActor* IgnoredActor, FNeonAoeResolvedDelegate OnResolved)
+{
+	UWorld* World = GetWorld();
+	if (!World || Shape.Radius <= 0.f)
+	{
+		return FNeonAoeRequestHandle();
+	}
+
+	if (!OverlapDelegate.IsBound())
+	{
+		OverlapDelegate.BindUObject(this, &UNeonAoeSubsystem::HandleOverlapCompleted);
+	}
+
+	FCollisionShape QueryShape = FCollisionShape::MakeSphere(Shape.Radius);
+	FQuat QueryRotation = FQuat::Identity;
+
+	if (Shape.Type == ENeonAoeShapeType::Capsule)
+	{
+		const FVector Axis = Shape.Direction.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+		QueryShape = FCollisionShape::MakeCapsule(Shape.Radius, Shape.HalfLength + Shape.Radius);
+		QueryRotation = FRotationMatrix::MakeFromZ(Axis).ToQuat();
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(NeonAoeOverlap), false, IgnoredActor);
+
+	// Never 0, even after wrapping
+	if (++LastRequestId == 0)
+	{
+		++LastRequestId;
+	}
+
+	const FTraceHandle TraceHandle = World->AsyncOverlapByChannel(
+		Shape.Center,
+		QueryRotation,
+		ECC_Pawn,
+		QueryShape,
+		QueryParams,
+		FCollisionResponseParams::DefaultResponseParam,
+		&OverlapDelegate,
+		LastRequestId
+	);
+
+	if (!TraceHandle.IsValid())
+	{
+		return FNeonAoeRequestHandle();
+	}
+
+	FPendingAoe& Pending = PendingRequests.Add(LastRequestId);
+	Pending.Shape = Shape;
+	Pending.IgnoredActor = IgnoredActor;
+	Pending.OnResolved = MoveTemp(OnResolved);
+
+	FNeonAoeRequestHandle Handle;
+	Handle.Id = LastRequestId;
+	return Handle;
+}
+
+/**
+ * Resolve + batched apply. The spec is built when the results arrive, so it reflects
+ * the attacker's attributes at impact rather than at the request.
+ */
+FNeonAoeRequestHandle UNeonAoeSubsystem::RequestAoeEffect(const FNeonAoeShape& Shape, AActor* SourceActor, TSubclassOf<UGameplayEffect> EffectClass, float Level, float DamageMagnitude)
+{
+	if (!EffectClass)
+	{
+		return FNeonAoeRequestHandle();
+	}
+
+	TWeakObjectPtr<AActor> WeakSource = SourceActor;
+
+	return RequestAoe(Shape, SourceActor, FNeonAoeResolvedDelegate::CreateWeakLambda(this,
+		[WeakSource, EffectClass, Level, DamageMagnitude](TArrayView<const FNeonAoeTarget> Targets)
+		{
+			if (Targets.Num() == 0)
+			{
+				return;
+			}
+
+			AActor* Source = WeakSource.Get();
+			UAbilitySystemComponent* SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Source);
+			const FGameplayEffectSpecHandle SpecHandle = UNeonEffectLibrary::MakeBatchEffectSpec(SourceASC, Source, Source, EffectClass, Level, DamageMagnitude);
+
+			TArray<UAbilitySystemComponent*, TInlineAllocator<32>> TargetASCs;
+			TArray<float, TInlineAllocator<32>> Scales;
+			for (const FNeonAoeTarget& Target : Targets)
+			{
+				TargetASCs.Add(Target.AbilitySystem);
+				Scales.Add(Target.Falloff);
+			}
+
+			UNeonEffectLibrary::ApplyEffectSpecToTargetsScaled(SpecHandle, TargetASCs, Scales);
+		}));
+}
+
+/**
+ * Requests leave the map when their overlap completes (or the world shuts down).
+ */
+bool UNeonAoeSubsystem::IsRequestPending(FNeonAoeRequestHandle Handle) const
+{
+	return Handle.IsValid() && PendingRequests.Contains(Handle.Id);
+}
+
+// ========================================
+// Resolution
+// ========================================
+
+/**
+ * Overlaps -> registry pawns -> exact shape test -> sort -> falloff.
+ */
+void UNeonAoeSubsystem::HandleOverlapCompleted(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapData)
+{
+	FPendingAoe Pending;
+	if (!PendingRequests.RemoveAndCopyValue(OverlapData.UserData, Pending))
+	{
+		return;
+	}
+
+	NEON_COMBAT_SCOPE(STAT_NeonAoeResolve);
+
+	UNeonCombatPawnRegistry* Registry = GetWorld() ? GetWorld()->GetSubsystem<UNeonCombatPawnRegistry>() : nullptr;
+	if (!Registry)
+	{
+		Pending.OnResolved.ExecuteIfBound(TArrayView<const FNeonAoeTarget>());
+		return;
+	}
+
+	Registry->RefreshSpatialHash();
+
+	const FNeonAoeShape& Shape = Pending.Shape;
+	const AActor* IgnoredActor = Pending.IgnoredActor.Get();
+
+	ScratchTargets.Reset();
+	ScratchNormalized.Reset();
+
+	// ========================================
+	// Map overlaps to combat pawns
+	// ========================================
+
+	// One bit per registry slot - a pawn with several overlapping components is only added once
+	TBitArray<TInlineAllocator<4>> SeenPawns(false, Registry->GetNumSlots());
+
+	for (const FOverlapResult& Overlap : OverlapData.OutOverlaps)
+	{
+		const APlayerCharacter* Pawn = Cast<APlayerCharacter>(Overlap.GetActor());
+		if (!Pawn || Pawn == IgnoredActor)
+		{
+			continue;
+		}
+
+		const int32 PawnIndex = Pawn->GetCombatRegistryIndex();
+		if (!SeenPawns.IsValidIndex(PawnIndex) || SeenPawns[PawnIndex])
+		{
+			continue;
+		}
+		SeenPawns[PawnIndex] = true;
+
+		FVector CapsuleCenter;
+		float CapsuleRadius = 0.f;
+		float CapsuleHalfHeight = 0.f;
+		if (!Registry->GetCapsule(PawnIndex, CapsuleCenter, CapsuleRadius, CapsuleHalfHeight))
+		{
+			continue;
+		}
+
+		float Distance = 0.f;
+		float FalloffRange = 0.f;
+		if (!TestShape(Shape, CapsuleCenter, CapsuleRadius, CapsuleHalfHeight, Distance, FalloffRange))
+		{
+			continue;
+		}
+
+		FNeonAoeTarget& Target = ScratchTargets.AddDefaulted_GetRef();
+		Target.Pawn = Registry->GetPawn(PawnIndex);
+		Target.AbilitySystem = Registry->GetAbilitySystemComponent(PawnIndex);
+		Target.Distance = Distance;
+		Target.PawnIndex = PawnIndex;
+
+		// Stash the range in Falloff until the vectorized pass turns it into a scale
+		Target.Falloff = FalloffRange;
+	}
+
+	// Nearest first (ties broken by slot for a stable order)
+	ScratchTargets.Sort([](const FNeonAoeTarget& A, const FNeonAoeTarget& B)
+	{
+		return A.Distance != B.Distance ? A.Distance < B.Distance : A.PawnIndex < B.PawnIndex;
+	});
+
+	// ========================================
+	// Falloff
+	// ========================================
+	const int32 NumTargets = ScratchTargets.Num();
+	ScratchNormalized.SetNumUninitialized(NumTargets);
+	ScratchScales.SetNumUninitialized(NumTargets);
+
+	for (int32 Index = 0; Index < NumTargets; ++Index)
+	{
+		const FNeonAoeTarget& Target = ScratchTargets[Index];
+		ScratchNormalized[Index] = Target.Falloff > UE_SMALL_NUMBER ? Target.Distance / Target.Falloff : 0.f;
+	}
+
+	ComputeFalloff(ScratchNormalized, Shape.FalloffExponent, Shape.MinFalloff, ScratchScales);
+
+	for (int32 Index = 0; Index < NumTargets; ++Index)
+	{
+		ScratchTargets[Index].Falloff = ScratchScales[Index];
+	}
+
+	Pending.OnResolved.ExecuteIfBound(ScratchTargets);
+}
+
+/**
+ * Capsules are treated as their vertical axis segment inflated by the radius.
+ *
+ * Sphere, cone and ring measure distance on the ground plane so a slam hits the same regardless
+ * of a target's height (within the vertical reach of the sphere).
+ */
+bool UNeonAoeSubsystem::TestShape(const FNeonAoeShape& Shape, const FVector& CapsuleCenter, float CapsuleRadius, float CapsuleHalfHeight, float& OutDistance, float& OutFalloffRange)
+{
+	const float InnerHalfHeight = FMath::Max(CapsuleHalfHeight - CapsuleRadius, 0.f);
+	const FVector AxisBottom = CapsuleCenter - FVector(0.f, 0.f, InnerHalfHeight);
+	const FVector AxisTop = CapsuleCenter + FVector(0.f, 0.f, InnerHalfHeight);
+
+	if (Shape.Type == ENeonAoeShapeType::Capsule)
+	{
+		const FVector Axis = Shape.Direction.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+		const FVector SegmentStart = Shape.Center - Axis * Shape.HalfLength;
+		const FVector SegmentEnd = Shape.Center + Axis * Shape.HalfLength;
+
+		FVector ClosestOnShape;
+		FVector ClosestOnCapsule;
+		FMath::SegmentDistToSegmentSafe(SegmentStart, SegmentEnd, AxisBottom, AxisTop, ClosestOnShape, ClosestOnCapsule);
+
+		const float Distance = FVector::Dist(ClosestOnShape, ClosestOnCapsule);
+		OutDistance = Distance;
+		OutFalloffRange = Shape.Radius;
+		return Distance <= Shape.Radius + CapsuleRadius;
+	}
+
+	// Vertical reach: the sphere must touch the capsule at all
+	if (FMath::PointDistToSegmentSquared(Shape.Center, AxisBottom, AxisTop) > FMath::Square(Shape.Radius + CapsuleRadius))
+	{
+		return false;
+	}
+
+	const FVector2D ToTarget(CapsuleCenter.X - Shape.Center.X, CapsuleCenter.Y - Shape.Center.Y);
+	const float GroundDistance = ToTarget.Size();
+
+	OutDistance = GroundDistance;
+	OutFalloffRange = Shape.Radius;
+
+	if (Shape.Type == ENeonAoeShapeType::Cone && GroundDistance > CapsuleRadius)
+	{
+		const FVector2D Facing = FVector2D(Shape.Direction.X, Shape.Direction.Y).GetSafeNormal();
+		if (!Facing.IsNearlyZero())
+		{
+			// Widen the cone by the angle the capsule's radius covers at this distance
+			const float CapsuleHalfAngle = FMath::Asin(FMath::Clamp(CapsuleRadius / GroundDistance, 0.f, 1.f));
+			const float MaxAngle = FMath::DegreesToRadians(Shape.HalfAngleDegrees) + CapsuleHalfAngle;
+			const float CosToTarget = FVector2D::DotProduct(Facing, ToTarget / GroundDistance);
+
+			if (CosToTarget < FMath::Cos(FMath::Min(MaxAngle, UE_PI)))
+			{
+				return false;
+			}
+		}
+	}
+	else if (Shape.Type == ENeonAoeShapeType::Ring)
+	{
+		if (GroundDistance + CapsuleRadius < Shape.InnerRadius)
+		{
+			return false;
+		}
+
+		// Falloff runs from the inner edge outwards
+		OutDistance = FMath::Max(GroundDistance - Shape.InnerRadius, 0.f);
+		OutFalloffRange = FMath::Max(Shape.Radius - Shape.InnerRadius, 0.f);
+	}
+
+	return true;
+}
+
+/**
+ * Scale = 1 - (1 - MinFalloff) * Clamp(t, 0, 1) ^ Exponent, 4 lanes at a time.
+ */
+void UNeonAoeSubsystem::ComputeFalloff(TArrayView<const float> NormalizedDistances, float Exponent, float MinFalloff, TArrayView<float> OutScales)
+{
+	check(OutScales.Num() >= NormalizedDistances.Num());
+
+	const int32 Num = NormalizedDistances.Num();
+
+	// No falloff - everything takes full effect
+	if (Exponent <= 0.f)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			OutScales[Index] = 1.f;
+		}
+		return;
+	}
+
+	const float Drop = 1.f - FMath::Clamp(MinFalloff, 0.f, 1.f);
+	const int32 NumVectorized = Num - (Num % FalloffWidth);
+
+	const VectorRegister4Float One = VectorSetFloat1(1.f);
+	const VectorRegister4Float DropVec = VectorSetFloat1(Drop);
+	const VectorRegister4Float ExponentVec = VectorSetFloat1(Exponent);
+
+	for (int32 Index = 0; Index < NumVectorized; Index += FalloffWidth)
+	{
+		const VectorRegister4Float T = VectorMin(VectorMax(VectorLoad(NormalizedDistances.GetData() + Index), VectorZeroFloat()), One);
+		const VectorRegister4Float Curve = VectorPow(T, ExponentVec);
+		VectorStore(VectorNegateMultiplyAdd(DropVec, Curve, One), OutScales.GetData() + Index);
+	}
+
+	// Leftovers that don't fill a register
+	for (int32 Index = NumVectorized; Index < Num; ++Index)
+	{
+		const float T = FMath::Clamp(NormalizedDistances[Index], 0.f, 1.f);
+		OutScales[Index] = 1.f - Drop * FMath::Pow(T, Exponent);
+	}
+}
+
+// ========================================
+// Lifetime
+// ========================================
+
+/**
+ * Outstanding queries complete into nothing once the requests are gone.
+ */
+void UNeonAoeSubsystem::Deinitialize()
+{
+	PendingRequests.Empty();
+	OverlapDelegate.Unbind();
+
+	Super::Deinitialize();
+}
+
+bool UNeonAoeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
\ No newline at end of file
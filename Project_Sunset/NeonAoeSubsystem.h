@@ -0,0 +1,210 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "NeonAoeSubsystem.generated.h"
+
+// Forward declarations
+class APlayerCharacter;
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * Shape of a ground-targeted area of effect.
+ */
+UENUM(BlueprintType)
+enum class ENeonAoeShapeType : uint8
+{
+	/** Everything within Radius of the center */
+	Sphere,
+
+	/** Sphere limited to HalfAngleDegrees around Direction (measured on the ground plane) */
+	Cone,
+
+	/** Capsule centered on the center, axis along Direction (beams, sweeps) */
+	Capsule,
+
+	/** Sphere with everything closer than InnerRadius (on the ground plane) cut out (shockwaves) */
+	Ring
+};
+
+/**
+ * Area of effect query description.
+ */
+USTRUCT(BlueprintType)
+struct FNeonAoeShape
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE")
+	ENeonAoeShapeType Type = ENeonAoeShapeType::Sphere;
+
+	/** Center of the area (impact point for slams) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE")
+	FVector Center = FVector::ZeroVector;
+
+	/** Cone facing / capsule axis */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE")
+	FVector Direction = FVector::ForwardVector;
+
+	/** Outer radius (capsule: radius around the axis) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE", Meta = (ClampMin = "0.0"))
+	float Radius = 500.f;
+
+	/** Ring only: inner radius of the safe zone */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE", Meta = (ClampMin = "0.0", EditCondition = "Type == ENeonAoeShapeType::Ring"))
+	float InnerRadius = 0.f;
+
+	/** Cone only: half opening angle */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE", Meta = (ClampMin = "0.0", ClampMax = "180.0", EditCondition = "Type == ENeonAoeShapeType::Cone"))
+	float HalfAngleDegrees = 45.f;
+
+	/** Capsule only: half length of the axis segment (not counting the radius) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE", Meta = (ClampMin = "0.0", EditCondition = "Type == ENeonAoeShapeType::Capsule"))
+	float HalfLength = 500.f;
+
+	/**
+	 * Falloff curve: Scale = 1 - (1 - MinFalloff) * NormalizedDistance ^ FalloffExponent.
+	 * 0 = no falloff, 1 = linear, 2 = quadratic.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE|Falloff", Meta = (ClampMin = "0.0"))
+	float FalloffExponent = 0.f;
+
+	/** Scale at the outer edge */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AOE|Falloff", Meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinFalloff = 0.f;
+};
+
+/**
+ * One combat pawn inside an area of effect.
+ */
+USTRUCT(BlueprintType)
+struct FNeonAoeTarget
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AOE")
+	APlayerCharacter* Pawn = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AOE")
+	UAbilitySystemComponent* AbilitySystem = nullptr;
+
+	/** Distance used for sorting and falloff (ground plane for sphere/cone/ring, from the axis for capsules) */
+	UPROPERTY(BlueprintReadOnly, Category = "AOE")
+	float Distance = 0.f;
+
+	/** Falloff scale in [MinFalloff, 1] */
+	UPROPERTY(BlueprintReadOnly, Category = "AOE")
+	float Falloff = 1.f;
+
+	/** Combat registry slot (tie breaker for a stable order) */
+	int32 PawnIndex = INDEX_NONE;
+};
+
+/**
+ * Identifies one AOE request. Opaque to Blueprints; ids are unsigned and skip 0 when they wrap.
+ */
+USTRUCT(BlueprintType)
+struct FNeonAoeRequestHandle
+{
+	GENERATED_BODY()
+
+	/** Request id (0 = no request) */
+	uint32 Id = 0;
+
+	bool IsValid() const { return Id != 0; }
+};
+
+/** Receives the resolved targets: deduplicated, sorted nearest first */
+DECLARE_DELEGATE_OneParam(FNeonAoeResolvedDelegate, TArrayView<const FNeonAoeTarget> /*Targets*/);
+
+/**
+ * Native area of effect resolution for slams and other ground-targeted attacks.
+ *
+ * A request issues an async physics overlap (AsyncOverlapByChannel on the Pawn channel) for the
+ * shape's bounding volume, so the query runs alongside the rest of the frame. Next frame the
+ * overlaps are mapped to combat registry pawns, deduplicated (one entry per pawn, not per
+ * component), tested against the exact shape using the registry's capsules, sorted nearest first
+ * and given falloff scales in one vectorized pass.
+ *
+ * The results are ready for UNeonEffectLibrary::ApplyEffectSpecToTargetsScaled;
+ * RequestAoeEffect does both steps.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonAoeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Queues an AOE query. The delegate runs next frame (not at all if the world shuts down first).
+	 *
+	 * @param Shape - Area to resolve
+	 * @param IgnoredActor - Actor excluded from the results (normally the attacker)
+	 * @param OnResolved - Receives the targets
+	 * @return Request handle (invalid if the query could not be issued)
+	 */
+	FNeonAoeRequestHandle RequestAoe(const FNeonAoeShape& Shape, const AActor* IgnoredActor, FNeonAoeResolvedDelegate OnResolved);
+
+	/**
+	 * Resolves an AOE next frame and applies one shared effect spec to every target,
+	 * with each target's falloff passed as the Data.Falloff SetByCaller magnitude.
+	 *
+	 * @param Shape - Area to resolve
+	 * @param SourceActor - Attacker (excluded from the targets, instigator of the effect)
+	 * @param EffectClass - Effect to apply
+	 * @param Level - Effect level
+	 * @param DamageMagnitude - Data.Damage SetByCaller magnitude; <= 0 leaves it unset
+	 * @return Request handle (invalid if the query could not be issued)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AOE")
+	FNeonAoeRequestHandle RequestAoeEffect(const FNeonAoeShape& Shape, AActor* SourceActor, TSubclassOf<UGameplayEffect> EffectClass, float Level = 1.f, float DamageMagnitude = 0.f);
+
+	/** True while a request's overlap is still in flight (its delegate hasn't run yet) */
+	UFUNCTION(BlueprintPure, Category = "AOE")
+	bool IsRequestPending(FNeonAoeRequestHandle Handle) const;
+
+	/**
+	 * Computes falloff scales for normalized distances, 4 at a time.
+	 *
+	 * @param NormalizedDistances - Distances divided by the falloff range (clamped to [0, 1] here)
+	 * @param OutScales - Receives one scale per distance
+	 */
+	static void ComputeFalloff(TArrayView<const float> NormalizedDistances, float Exponent, float MinFalloff, TArrayView<float> OutScales);
+
+	/** Exact shape test and falloff distance for one capsule (both in world space) */
+	static bool TestShape(const FNeonAoeShape& Shape, const FVector& CapsuleCenter, float CapsuleRadius, float CapsuleHalfHeight, float& OutDistance, float& OutFalloffRange);
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds resolve AOEs */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Request waiting for its async overlap */
+	struct FPendingAoe
+	{
+		FNeonAoeShape Shape;
+		TWeakObjectPtr<const AActor> IgnoredActor;
+		FNeonAoeResolvedDelegate OnResolved;
+	};
+
+	/** Async overlap completion (next frame, game thread) */
+	void HandleOverlapCompleted(const FTraceHandle& TraceHandle, FOverlapDatum& OverlapData);
+
+	/** Requests by id (passed through the async query's UserData) */
+	TMap<uint32, FPendingAoe> PendingRequests;
+
+	/** Last id handed out (0 is never used) */
+	uint32 LastRequestId = 0;
+
+	/** Bound once, shared by every query */
+	FOverlapDelegate OverlapDelegate;
+
+	/** Scratch buffers reused across requests */
+	TArray<FNeonAoeTarget> ScratchTargets;
+	TArray<float> ScratchNormalized;
+	TArray<float> ScratchScales;
+};
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "NeonAssetPreloadSubsystem.h"
+#include "NeonPreloadManifest.h"
+#include "NeonCombatLog.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+/**
+ * Pass 1 loads the manifest's classes (and the extras); pass 2 can only be gathered once
+ * those classes exist, since it reads their defaults.
+ */
+void UNeonAssetPreloadSubsystem::PreloadAssets(const UNeonPreloadManifest* Manifest, TArray<FSoftObjectPath> ExtraAssets, FSimpleDelegate OnReady)
+{
+	TArray<FSoftObjectPath> DirectAssets = MoveTemp(ExtraAssets);
+	DirectAssets.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+
+	if (Manifest)
+	{
+		Manifest->GetDirectAssets(DirectAssets);
+	}
+
+	TWeakObjectPtr<const UNeonPreloadManifest> WeakManifest = Manifest;
+
+	LoadAsync(MoveTemp(DirectAssets), FSimpleDelegate::CreateWeakLambda(this, [this, WeakManifest, OnReady]()
+	{
+		TArray<FSoftObjectPath> DependentAssets;
+		if (const UNeonPreloadManifest* LoadedManifest = WeakManifest.Get())
+		{
+			LoadedManifest->GetDependentAssets(DependentAssets);
+		}
+
+		LoadAsync(MoveTemp(DependentAssets), OnReady);
+	}));
+}
+
+/**
+ * Each path is only requested once per world; the streamable manager ignores it if it is already loaded.
+ */
+void UNeonAssetPreloadSubsystem::RequestLoad(const FSoftObjectPath& Path)
+{
+	if (Path.IsNull())
+	{
+		return;
+	}
+
+	bool bAlreadyRequested = false;
+	RequestedPaths.Add(Path, &bAlreadyRequested);
+	if (bAlreadyRequested)
+	{
+		return;
+	}
+
+	NEON_COMBAT_LOG(Warning, TEXT("%s was needed before it was preloaded - loading it async (add it to a preload manifest)"), *Path.ToString());
+
+	LoadAsync({ Path }, FSimpleDelegate());
+}
+
+/**
+ * Handles are released here so preloaded assets can be garbage collected with the world.
+ */
+void UNeonAssetPreloadSubsystem::Deinitialize()
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : RetainedHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->CancelHandle();
+		}
+	}
+
+	RetainedHandles.Empty();
+	ResidentAssets.Empty();
+	RequestedPaths.Empty();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds stream combat assets.
+ */
+bool UNeonAssetPreloadSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * Static entry point for ResolveClass/ResolveObject.
+ */
+void UNeonAssetPreloadSubsystem::RequestLoadFor(const UObject* WorldContext, const FSoftObjectPath& Path)
+{
+	const UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+	if (UNeonAssetPreloadSubsystem* Preloader = World ? World->GetSubsystem<UNeonAssetPreloadSubsystem>() : nullptr)
+	{
+		Preloader->RequestLoad(Path);
+	}
+}
+
+/**
+ * Nothing to load (or everything already resident) completes right away.
+ * Resident assets are referenced directly - no handle would keep them from being unloaded otherwise.
+ */
+void UNeonAssetPreloadSubsystem::LoadAsync(TArray<FSoftObjectPath> Paths, FSimpleDelegate OnLoaded)
+{
+	Paths.RemoveAll([this](const FSoftObjectPath& Path)
+	{
+		if (Path.IsNull())
+		{
+			return true;
+		}
+
+		if (UObject* Resident = Path.ResolveObject())
+		{
+			ResidentAssets.AddUnique(Resident);
+			return true;
+		}
+
+		return false;
+	});
+
+	if (Paths.Num() == 0)
+	{
+		OnLoaded.ExecuteIfBound();
+		return;
+	}
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+		MoveTemp(Paths),
+		FStreamableDelegate::CreateWeakLambda(this, [OnLoaded]()
+		{
+			OnLoaded.ExecuteIfBound();
+		}),
+		FStreamableManager::AsyncLoadHighPriority
+	);
+
+	if (Handle.IsValid())
+	{
+		RetainedHandles.Add(MoveTemp(Handle));
+	}
+	else
+	{
+		// Nothing valid to stream (bad paths) - don't leave the caller waiting
+		OnLoaded.ExecuteIfBound();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/World.h"
+#include "NeonAssetPreloadSubsystem.generated.h"
+
+// Forward declarations
+class UNeonPreloadManifest;
+struct FStreamableHandle;
+
+/**
+ * World subsystem that streams combat assets in the background so gameplay code never sync-loads.
+ *
+ * - PreloadAssets() is called by characters as they spawn; it streams their manifest (two passes)
+ *   and signals when everything is resident
+ * - ResolveClass()/ResolveObject() are for hot paths: they return the asset if it is loaded, otherwise
+ *   start an async load and return nullptr instead of blocking
+ *
+ * Every handle (and every asset that was already resident when requested) is kept until the world goes away,
+ * so preloaded assets stay resident for the whole fight.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonAssetPreloadSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Streams a manifest plus any extra assets, then the assets referenced by the manifest's classes.
+	 * OnReady runs once everything is loaded (immediately if it already is).
+	 *
+	 * @param Manifest - Character's preload manifest (may be null)
+	 * @param ExtraAssets - Additional assets loaded in the first pass (e.g. the character's own effects)
+	 * @param OnReady - Readiness callback
+	 */
+	void PreloadAssets(const UNeonPreloadManifest* Manifest, TArray<FSoftObjectPath> ExtraAssets, FSimpleDelegate OnReady);
+
+	/** Starts an async load unless the asset is loaded or already loading */
+	void RequestLoad(const FSoftObjectPath& Path);
+
+	/**
+	 * Non-blocking resolve for soft class references.
+	 *
+	 * @return The class if loaded; otherwise nullptr (and an async load is started)
+	 */
+	template<typename T>
+	static TSubclassOf<T> ResolveClass(const UObject* WorldContext, const TSoftClassPtr<T>& SoftClass)
+	{
+		if (UClass* Loaded = SoftClass.Get())
+		{
+			return Loaded;
+		}
+
+		RequestLoadFor(WorldContext, SoftClass.ToSoftObjectPath());
+		return nullptr;
+	}
+
+	/**
+	 * Non-blocking resolve for soft object references.
+	 *
+	 * @return The object if loaded; otherwise nullptr (and an async load is started)
+	 */
+	template<typename T>
+	static T* ResolveObject(const UObject* WorldContext, const TSoftObjectPtr<T>& SoftObject)
+	{
+		if (T* Loaded = SoftObject.Get())
+		{
+			return Loaded;
+		}
+
+		RequestLoadFor(WorldContext, SoftObject.ToSoftObjectPath());
+		return nullptr;
+	}
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds stream combat assets */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** RequestLoad on WorldContext's subsystem (no-op for null paths or worlds without the subsystem) */
+	static void RequestLoadFor(const UObject* WorldContext, const FSoftObjectPath& Path);
+
+	/** Streams Paths and runs OnLoaded when done; the handle is kept in RetainedHandles */
+	void LoadAsync(TArray<FSoftObjectPath> Paths, FSimpleDelegate OnLoaded);
+
+	/** Handles of every load started in this world (keeps the assets resident) */
+	TArray<TSharedPtr<FStreamableHandle>> RetainedHandles;
+
+	/** Requested assets that were already loaded (no handle was made for them) */
+	UPROPERTY()
+	TArray<UObject*> ResidentAssets;
+
+	/** Paths requested through RequestLoad (avoids stacking loads for a path hit every frame) */
+	TSet<FSoftObjectPath> RequestedPaths;
+};
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include "NeonAttributeEventSubsystem.h"
+#include "PlayerCharacter.h"
+#include "NeonCombatStats.h"
+
+/**
+ * Characters guard against double queueing themselves, so this is a plain append.
+ */
+void UNeonAttributeEventSubsystem::QueueFlush(APlayerCharacter* Character)
+{
+	QueuedCharacters.Add(Character);
+}
+
+/**
+ * Runs after the frame's actor and component ticks, so every change made this frame is in the flush.
+ */
+void UNeonAttributeEventSubsystem::Tick(float DeltaTime)
+{
+	if (QueuedCharacters.Num() == 0)
+	{
+		return;
+	}
+
+	NEON_COMBAT_SCOPE(STAT_NeonAttributeEventFlush);
+
+	// Blueprint handlers may change attributes again - those changes queue for next frame
+	Swap(QueuedCharacters, FlushingCharacters);
+
+	for (const TWeakObjectPtr<APlayerCharacter>& WeakCharacter : FlushingCharacters)
+	{
+		if (APlayerCharacter* Character = WeakCharacter.Get())
+		{
+			Character->FlushAttributeEvents();
+		}
+	}
+
+	FlushingCharacters.Reset();
+}
+
+TStatId UNeonAttributeEventSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNeonAttributeEventSubsystem, STATGROUP_Tickables);
+}
+
+/**
+ * Pending events are dropped with the world.
+ */
+void UNeonAttributeEventSubsystem::Deinitialize()
+{
+	QueuedCharacters.Empty();
+	FlushingCharacters.Empty();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds run attribute UI.
+ */
+bool UNeonAttributeEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonAttributeEventSubsystem.generated.h"
+
+// Forward declarations
+class APlayerCharacter;
+
+/**
+ * Coalesces attribute change notifications into one UI update per character per frame.
+ *
+ * Characters mark attributes dirty as GAS changes them and queue themselves here once;
+ * at the end of the frame each queued character flushes a single OnAttributesChanged event with
+ * every changed value. Stamina regen that touches the attribute every tick costs one Blueprint call per
+ * frame instead of one per change.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonAttributeEventSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Queues a character for the end-of-frame flush (callers only queue once per frame) */
+	void QueueFlush(APlayerCharacter* Character);
+
+	// ========================================
+	// FTickableGameObject Interface
+	// ========================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// USubsystem Interface
+	// ========================================
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds run attribute UI */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Characters with dirty attributes this frame */
+	TArray<TWeakObjectPtr<APlayerCharacter>> QueuedCharacters;
+
+	/** Swapped with QueuedCharacters during the flush so events can queue for the next frame */
+	TArray<TWeakObjectPtr<APlayerCharacter>> FlushingCharacters;
+};
\ No newline at end of file
@@ -1,5 +1,41 @@
 #include "NeonAttributeSet.h"
 #include "GameplayEffectExtension.h"
+#include "NeonCombatLog.h"
+#include "NeonCombatStats.h"
+#include "NeonCombatEventSubsystem.h"
+#include "NeonDamageExecCalculation.h"
+#include "NeonGameplayTags.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+/**
+ * MaxHealth as a packed integer, Health as a 16-bit fraction of MaxHealth.
+ */
+bool FNeonQuantizedHealth::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 PackedMax = 0;
+	uint16 PackedFraction = 0;
+
+	if (Ar.IsSaving())
+	{
+		PackedMax = static_cast<uint32>(FMath::Max(FMath::RoundToInt32(MaxHealth), 0));
+		PackedFraction = PackedMax > 0
+			? static_cast<uint16>(FMath::RoundToInt32(FMath::Clamp(Health / static_cast<float>(PackedMax), 0.f, 1.f) * MAX_uint16))
+			: 0;
+	}
+
+	Ar.SerializeIntPacked(PackedMax);
+	Ar << PackedFraction;
+
+	if (Ar.IsLoading())
+	{
+		MaxHealth = static_cast<float>(PackedMax);
+		Health = MaxHealth * (static_cast<float>(PackedFraction) / MAX_uint16);
+	}
+
+	bOutSuccess = true;
+	return true;
+}
 
 /**
  * Constructor - Initializes all attributes to their default values.
@@ -21,6 +57,15 @@ UNeonAttributeSet::UNeonAttributeSet()
 	// Initialize Ultimate system (starts empty)
 	InitUltimateCharge(0.0f);
 	InitMaxUltimateCharge(50.0f);
+
+	// Initialize combat stats (neutral: base damage in and out)
+	InitAttackPower(1.0f);
+	InitNeonPotency(1.0f);
+	InitDefense(0.0f);
+	InitNeonResistance(0.0f);
+
+	QuantizedHealth.Health = GetHealth();
+	QuantizedHealth.MaxHealth = GetMaxHealth();
 }
 
 /**
@@ -51,6 +96,18 @@ void UNeonAttributeSet::PreAttributeChange(
 	{
 		NewValue = FMath::Max(NewValue, 0.0f);
 	}
+
+	// Negative multipliers or defense would turn damage into healing
+	if (Attribute == GetAttackPowerAttribute() || Attribute == GetNeonPotencyAttribute() || Attribute == GetDefenseAttribute())
+	{
+		NewValue = FMath::Max(NewValue, 0.0f);
+	}
+
+	// Resistance is a fraction of the damage ignored
+	if (Attribute == GetNeonResistanceAttribute())
+	{
+		NewValue = FMath::Clamp(NewValue, 0.0f, 1.0f);
+	}
 }
 
 /**
@@ -63,16 +120,17 @@ void UNeonAttributeSet::PostGameplayEffectExecute(
 {
 	Super::PostGameplayEffectExecute(Data);
 
-	UE_LOG(LogTemp, Warning, TEXT("PostGameplayEffectExecute called on actor: %s"), 
-		*GetOwningActor()->GetName());
+	NEON_COMBAT_SCOPE(STAT_NeonAttributePostExecute);
+
+	NEON_COMBAT_VERBOSE(TEXT("PostGameplayEffectExecute called on actor: %s"), 
+		*GetNameSafe(GetOwningActor()));
 
 	// ========================================
 	// Health Modification Handling
 	// ========================================
 	if (Data.EvaluatedData.Attribute == GetHealthAttribute())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Health attribute was modified!"));
-		UE_LOG(LogTemp, Warning, TEXT("Magnitude: %.1f (negative = damage)"), 
+		NEON_COMBAT_VERBOSE(TEXT("Health modified - Magnitude: %.1f (negative = damage)"), 
 			Data.EvaluatedData.Magnitude);
 		
 		// Clamp health between 0 and max
@@ -81,22 +139,44 @@ void UNeonAttributeSet::PostGameplayEffectExecute(
 		// Check if damage was dealt (negative magnitude indicates damage)
 		if (Data.EvaluatedData.Magnitude < 0.0f)
 		{
-			float DamageAmount = FMath::Abs(Data.EvaluatedData.Magnitude);
+			const FGameplayEffectContextHandle& Context = Data.EffectSpec.GetContext();
+
+			FNeonDamageEvent DamageEvent;
+			DamageEvent.Target = GetOwningActor();
+			DamageEvent.Instigator = Context.GetInstigator();
+			DamageEvent.Causer = Context.GetEffectCauser();
+			DamageEvent.Amount = FMath::Abs(Data.EvaluatedData.Magnitude);
+			DamageEvent.HealthAfter = GetHealth();
+			if (UNeonDamageExecCalculation::SpecHasAssetTag(Data.EffectSpec, NeonGameplayTags::Damage_Type_Neon))
+			{
+				DamageEvent.DamageType = NeonGameplayTags::Damage_Type_Neon;
+			}
 			
-			UE_LOG(LogTemp, Error, TEXT("=== DAMAGE DETECTED ==="));
-			UE_LOG(LogTemp, Error, TEXT("Damage Amount: %.1f to actor: %s"), 
-				DamageAmount, *GetOwningActor()->GetName());
-			UE_LOG(LogTemp, Error, TEXT("Delegate IsBound: %s"), 
+			NEON_COMBAT_VERBOSE(TEXT("Damage Amount: %.1f to actor: %s (native bound: %s, blueprint bound: %s)"), 
+				DamageEvent.Amount, *GetNameSafe(DamageEvent.Target),
+				OnDamageTakenNative.IsBound() ? TEXT("TRUE") : TEXT("FALSE"),
 				OnDamageTaken.IsBound() ? TEXT("TRUE") : TEXT("FALSE"));
 			
-			// Broadcast damage event (characters bind to this for reactions)
-			OnDamageTaken.Broadcast(DamageAmount, GetOwningActor());
-			UE_LOG(LogTemp, Error, TEXT("Broadcast called!"));
+			// Listeners on this target (characters bind to this for reactions)
+			OnDamageTakenNative.Broadcast(DamageEvent);
+
+			// Blueprint adapter - reflection dispatch only when someone opted in
+			if (OnDamageTaken.IsBound())
+			{
+				OnDamageTaken.Broadcast(DamageEvent.Amount, DamageEvent.Target);
+			}
+
+			// World-wide stream and event ring (combat log, damage numbers, telemetry)
+			UWorld* World = GetWorld();
+			if (UNeonCombatEventSubsystem* CombatEvents = World ? World->GetSubsystem<UNeonCombatEventSubsystem>() : nullptr)
+			{
+				CombatEvents->BroadcastDamage(DamageEvent);
+			}
 		}
 		else
 		{
 			// Positive magnitude = healing
-			UE_LOG(LogTemp, Log, TEXT("Healing detected (positive magnitude): %.1f"), 
+			NEON_COMBAT_VERBOSE(TEXT("Healing detected (positive magnitude): %.1f"), 
 				Data.EvaluatedData.Magnitude);
 		}
 	}
@@ -117,7 +197,7 @@ void UNeonAttributeSet::PostGameplayEffectExecute(
 	{
 		// Clamp Stamina between 0 and max
 		SetStamina(FMath::Clamp(GetStamina(), 0.0f, GetMaxStamina()));
-		UE_LOG(LogTemp, Log, TEXT("Stamina changed: %.1f / %.1f"), 
+		NEON_COMBAT_VERBOSE(TEXT("Stamina changed: %.1f / %.1f"), 
 			GetStamina(), GetMaxStamina());
 	}
 
@@ -128,7 +208,243 @@ void UNeonAttributeSet::PostGameplayEffectExecute(
 	{
 		// Clamp Ultimate Charge between 0 and max
 		SetUltimateCharge(FMath::Clamp(GetUltimateCharge(), 0.0f, GetMaxUltimateCharge()));
-		UE_LOG(LogTemp, Log, TEXT("Ultimate Charge: %.0f / %.0f"), 
+		NEON_COMBAT_VERBOSE(TEXT("Ultimate Charge: %.0f / %.0f"), 
 			GetUltimateCharge(), GetMaxUltimateCharge());
 	}
+}
+
+// ========================================
+// Replication
+// ========================================
+
+/**
+ * Owner gets everything; everyone else gets the quantized health.
+ * All properties are push based, so the server only compares them after MARK_PROPERTY_DIRTY.
+ */
+void UNeonAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams OwnerParams;
+	OwnerParams.Condition = COND_OwnerOnly;
+	OwnerParams.RepNotifyCondition = REPNOTIFY_Always;
+	OwnerParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, Health, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, MaxHealth, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, Neon, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, MaxNeon, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, Stamina, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, MaxStamina, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, UltimateCharge, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, MaxUltimateCharge, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, AttackPower, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, NeonPotency, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, Defense, OwnerParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, NeonResistance, OwnerParams);
+
+	FDoRepLifetimeParams ProxyParams;
+	ProxyParams.Condition = COND_SkipOwner;
+	ProxyParams.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UNeonAttributeSet, QuantizedHealth, ProxyParams);
+}
+
+/**
+ * Every path that changes a current value ends up here, so this is the single place attributes are marked dirty.
+ */
+void UNeonAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	MarkAttributeDirty(Attribute);
+}
+
+/**
+ * Base value changes can leave the current value untouched (e.g. under an override), but still need to replicate.
+ */
+void UNeonAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	// The engine declares this const; dirty tracking is bookkeeping, not a change to the attribute values
+	const_cast<UNeonAttributeSet*>(this)->MarkAttributeDirty(Attribute);
+}
+
+/**
+ * Used after InitX calls, which write the values directly.
+ */
+void UNeonAttributeSet::MarkAllAttributesDirty()
+{
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Health, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxHealth, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Neon, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxNeon, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Stamina, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxStamina, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, UltimateCharge, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxUltimateCharge, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, AttackPower, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, NeonPotency, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Defense, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, NeonResistance, this);
+
+	UpdateQuantizedHealth();
+}
+
+/**
+ * Attribute -> replicated property. Health and MaxHealth also refresh the quantized copy.
+ */
+void UNeonAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute)
+{
+	if (Attribute == GetHealthAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Health, this);
+		UpdateQuantizedHealth();
+	}
+	else if (Attribute == GetMaxHealthAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxHealth, this);
+		UpdateQuantizedHealth();
+	}
+	else if (Attribute == GetNeonAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Neon, this);
+	}
+	else if (Attribute == GetMaxNeonAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxNeon, this);
+	}
+	else if (Attribute == GetStaminaAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Stamina, this);
+	}
+	else if (Attribute == GetMaxStaminaAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxStamina, this);
+	}
+	else if (Attribute == GetUltimateChargeAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, UltimateCharge, this);
+	}
+	else if (Attribute == GetMaxUltimateChargeAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, MaxUltimateCharge, this);
+	}
+	else if (Attribute == GetAttackPowerAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, AttackPower, this);
+	}
+	else if (Attribute == GetNeonPotencyAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, NeonPotency, this);
+	}
+	else if (Attribute == GetDefenseAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, Defense, this);
+	}
+	else if (Attribute == GetNeonResistanceAttribute())
+	{
+		MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, NeonResistance, this);
+	}
+}
+
+/**
+ * Only marks dirty on a real change - a regen tick at full health sends nothing.
+ */
+void UNeonAttributeSet::UpdateQuantizedHealth()
+{
+	const float NewHealth = GetHealth();
+	const float NewMaxHealth = GetMaxHealth();
+
+	if (QuantizedHealth.Health == NewHealth && QuantizedHealth.MaxHealth == NewMaxHealth)
+	{
+		return;
+	}
+
+	QuantizedHealth.Health = NewHealth;
+	QuantizedHealth.MaxHealth = NewMaxHealth;
+	MARK_PROPERTY_DIRTY_FROM_NAME(UNeonAttributeSet, QuantizedHealth, this);
+}
+
+/**
+ * Standard GAS rep notifies - update the ASC's aggregators and fire the attribute change delegates.
+ */
+void UNeonAttributeSet::OnRep_Health(const FGameplayAttributeData& OldHealth)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, Health, OldHealth);
+}
+
+void UNeonAttributeSet::OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, MaxHealth, OldMaxHealth);
+}
+
+void UNeonAttributeSet::OnRep_Neon(const FGameplayAttributeData& OldNeon)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, Neon, OldNeon);
+}
+
+void UNeonAttributeSet::OnRep_MaxNeon(const FGameplayAttributeData& OldMaxNeon)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, MaxNeon, OldMaxNeon);
+}
+
+void UNeonAttributeSet::OnRep_Stamina(const FGameplayAttributeData& OldStamina)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, Stamina, OldStamina);
+}
+
+void UNeonAttributeSet::OnRep_MaxStamina(const FGameplayAttributeData& OldMaxStamina)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, MaxStamina, OldMaxStamina);
+}
+
+void UNeonAttributeSet::OnRep_UltimateCharge(const FGameplayAttributeData& OldUltimateCharge)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, UltimateCharge, OldUltimateCharge);
+}
+
+void UNeonAttributeSet::OnRep_MaxUltimateCharge(const FGameplayAttributeData& OldMaxUltimateCharge)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, MaxUltimateCharge, OldMaxUltimateCharge);
+}
+
+void UNeonAttributeSet::OnRep_AttackPower(const FGameplayAttributeData& OldAttackPower)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, AttackPower, OldAttackPower);
+}
+
+void UNeonAttributeSet::OnRep_NeonPotency(const FGameplayAttributeData& OldNeonPotency)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, NeonPotency, OldNeonPotency);
+}
+
+void UNeonAttributeSet::OnRep_Defense(const FGameplayAttributeData& OldDefense)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, Defense, OldDefense);
+}
+
+void UNeonAttributeSet::OnRep_NeonResistance(const FGameplayAttributeData& OldNeonResistance)
+{
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, NeonResistance, OldNeonResistance);
+}
+
+/**
+ * Non-owning clients never receive the full attributes, so the quantized values become both
+ * base and current value, then go through the same path a full rep notify would.
+ */
+void UNeonAttributeSet::OnRep_QuantizedHealth()
+{
+	const FGameplayAttributeData OldHealth = Health;
+	const FGameplayAttributeData OldMaxHealth = MaxHealth;
+
+	MaxHealth.SetBaseValue(QuantizedHealth.MaxHealth);
+	MaxHealth.SetCurrentValue(QuantizedHealth.MaxHealth);
+	Health.SetBaseValue(QuantizedHealth.Health);
+	Health.SetCurrentValue(QuantizedHealth.Health);
+
+	// Max first so Health listeners read the new max
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, MaxHealth, OldMaxHealth);
+	GAMEPLAYATTRIBUTE_REPNOTIFY(UNeonAttributeSet, Health, OldHealth);
 }
\ No newline at end of file
@@ -16,15 +16,84 @@
 	GAMEPLAYATTRIBUTE_VALUE_INITTER(PropertyName)
 
 /**
- * Delegate that broadcasts when an actor takes damage.
- * Other systems can bind to this to react to damage (UI updates, AI reactions, etc.)
+ * One damage application, as seen by the attribute set that took it.
+ * Passed by reference to native listeners; nothing here outlives the broadcast.
+ */
+struct FNeonDamageEvent
+{
+	/** Actor that took the damage (owner of the attribute set) */
+	AActor* Target = nullptr;
+
+	/** Actor responsible for the damage (effect context instigator, may be null) */
+	AActor* Instigator = nullptr;
+
+	/** Actor that physically caused it, e.g. a projectile (effect context causer, may be null) */
+	AActor* Causer = nullptr;
+
+	/** Damage dealt (positive) */
+	float Amount = 0.f;
+
+	/** Target health after the damage was applied and clamped */
+	float HealthAfter = 0.f;
+
+	/** Damage type asset tag of the effect (empty for untyped damage) */
+	FGameplayTag DamageType;
+};
+
+/**
+ * Native damage delegate. Used per attribute set (one target) and by UNeonCombatEventSubsystem (every target).
+ * Bound with AddUObject/AddRaw/AddLambda - no reflection or ProcessEvent on dispatch.
+ */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnNeonDamageNative, const FNeonDamageEvent&);
+
+/**
+ * Blueprint damage delegate. Only broadcast when something is bound to it (opt-in adapter over the native event).
  */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDamageTaken, float, DamageAmount, AActor*, DamagedActor);
 
+/**
+ * Health and MaxHealth packed for clients that don't own the character (enemy and teammate health bars).
+ * MaxHealth is sent as a packed integer and Health as a 16-bit fraction of it - usually 3-4 bytes
+ * instead of the 16 bytes of two full FGameplayAttributeData.
+ */
+USTRUCT()
+struct PROJECT_SUNSET_API FNeonQuantizedHealth
+{
+	GENERATED_BODY()
+
+	/** Current health (precision is MaxHealth / 65535 after replication) */
+	float Health = 0.f;
+
+	/** Maximum health (whole numbers after replication) */
+	float MaxHealth = 0.f;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FNeonQuantizedHealth& Other) const
+	{
+		return Health == Other.Health && MaxHealth == Other.MaxHealth;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FNeonQuantizedHealth> : public TStructOpsTypeTraitsBase2<FNeonQuantizedHealth>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
 /**
  * Attribute Set containing all character stats for the game.
- * Manages Health, Neon (mana/style), Stamina, and Ultimate Charge.
+ * Manages Health, Neon (mana/style), Stamina, Ultimate Charge and the combat stats read by the damage exec.
  * Handles clamping values and broadcasting damage events.
+ *
+ * Replication (push model - a property is only compared and sent after it is marked dirty):
+ * - The owning client gets every attribute in full
+ * - Everyone else only gets FNeonQuantizedHealth, which is all a health bar needs
+ * Max values change rarely, so with push model they cost nothing until they actually change.
  */
 UCLASS()
 class PROJECT_SUNSET_API UNeonAttributeSet : public UAttributeSet
@@ -34,9 +103,14 @@ class PROJECT_SUNSET_API UNeonAttributeSet : public UAttributeSet
 public:
 	UNeonAttributeSet();
 
+	/**
+	 * Native event that fires when damage is applied to this attribute set's owner.
+	 * Only this owner's damage is broadcast here, so listeners don't need to filter by target.
+	 */
+	FOnNeonDamageNative OnDamageTakenNative;
+
 	/** 
-	 * Delegate that fires when damage is applied to this attribute set's owner.
-	 * Bind to this in characters to react to damage events.
+	 * Blueprint version of OnDamageTakenNative. Skipped entirely while nothing is bound.
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "Attributes")
 	FOnDamageTaken OnDamageTaken;
@@ -63,17 +137,34 @@ public:
 		const FGameplayEffectModCallbackData& Data
 	) override;
 
+	/**
+	 * Called after any attribute's current value changes (effects, aggregators, SetX accessors).
+	 * Marks the matching replicated property dirty for push-model replication.
+	 */
+	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
+
+	/** Same as PostAttributeChange for base values (base and current replicate together) */
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * Marks every replicated attribute dirty and refreshes the quantized health.
+	 * Call after setting attributes with the InitX accessors, which bypass the ability system.
+	 */
+	void MarkAllAttributesDirty();
+
 	// ========================================
 	// Health Attributes
 	// ========================================
 	
 	/** Current health value */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes", ReplicatedUsing = OnRep_Health)
 	FGameplayAttributeData Health;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, Health);
 
 	/** Maximum health value */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes", ReplicatedUsing = OnRep_MaxHealth)
 	FGameplayAttributeData MaxHealth;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, MaxHealth);
 
@@ -82,12 +173,12 @@ public:
 	// ========================================
 	
 	/** Current Neon value (used for abilities/style attacks) */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes", ReplicatedUsing = OnRep_Neon)
 	FGameplayAttributeData Neon;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, Neon);
 
 	/** Maximum Neon value */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes", ReplicatedUsing = OnRep_MaxNeon)
 	FGameplayAttributeData MaxNeon;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, MaxNeon);
 
@@ -96,12 +187,12 @@ public:
 	// ========================================
 	
 	/** Current stamina value (used for sprinting, dodging, etc.) */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes", ReplicatedUsing = OnRep_Stamina)
 	FGameplayAttributeData Stamina;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, Stamina);
 
 	/** Maximum stamina value */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes", ReplicatedUsing = OnRep_MaxStamina)
 	FGameplayAttributeData MaxStamina;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, MaxStamina);
 	
@@ -110,12 +201,92 @@ public:
 	// ========================================
 	
 	/** Current ultimate charge (builds up to enable ultimate ability) */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Ultimate")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Ultimate", ReplicatedUsing = OnRep_UltimateCharge)
 	FGameplayAttributeData UltimateCharge;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, UltimateCharge);
 	
 	/** Maximum ultimate charge required to use ultimate */
-	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Ultimate")
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Ultimate", ReplicatedUsing = OnRep_MaxUltimateCharge)
 	FGameplayAttributeData MaxUltimateCharge;
 	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, MaxUltimateCharge);
+
+	// ========================================
+	// Combat Attributes
+	// ========================================
+
+	/** Outgoing damage multiplier (1 = base damage; snapshotted when the damage spec is made) */
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Combat", ReplicatedUsing = OnRep_AttackPower)
+	FGameplayAttributeData AttackPower;
+	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, AttackPower);
+
+	/** Extra multiplier for outgoing Neon-type damage (1 = no bonus; snapshotted with the spec) */
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Combat", ReplicatedUsing = OnRep_NeonPotency)
+	FGameplayAttributeData NeonPotency;
+	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, NeonPotency);
+
+	/** Reduces all incoming damage: damage * 100 / (100 + Defense) */
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Combat", ReplicatedUsing = OnRep_Defense)
+	FGameplayAttributeData Defense;
+	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, Defense);
+
+	/** Fraction of incoming Neon-type damage ignored, 0 to 1 */
+	UPROPERTY(BlueprintReadOnly, Category = "Attributes|Combat", ReplicatedUsing = OnRep_NeonResistance)
+	FGameplayAttributeData NeonResistance;
+	ATTRIBUTE_ACCESSORS(UNeonAttributeSet, NeonResistance);
+
+	// ========================================
+	// Replication
+	// ========================================
+
+	/** Health and MaxHealth for non-owning clients */
+	UPROPERTY(ReplicatedUsing = OnRep_QuantizedHealth)
+	FNeonQuantizedHealth QuantizedHealth;
+
+protected:
+	UFUNCTION()
+	virtual void OnRep_Health(const FGameplayAttributeData& OldHealth);
+
+	UFUNCTION()
+	virtual void OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth);
+
+	UFUNCTION()
+	virtual void OnRep_Neon(const FGameplayAttributeData& OldNeon);
+
+	UFUNCTION()
+	virtual void OnRep_MaxNeon(const FGameplayAttributeData& OldMaxNeon);
+
+	UFUNCTION()
+	virtual void OnRep_Stamina(const FGameplayAttributeData& OldStamina);
+
+	UFUNCTION()
+	virtual void OnRep_MaxStamina(const FGameplayAttributeData& OldMaxStamina);
+
+	UFUNCTION()
+	virtual void OnRep_UltimateCharge(const FGameplayAttributeData& OldUltimateCharge);
+
+	UFUNCTION()
+	virtual void OnRep_MaxUltimateCharge(const FGameplayAttributeData& OldMaxUltimateCharge);
+
+	UFUNCTION()
+	virtual void OnRep_AttackPower(const FGameplayAttributeData& OldAttackPower);
+
+	UFUNCTION()
+	virtual void OnRep_NeonPotency(const FGameplayAttributeData& OldNeonPotency);
+
+	UFUNCTION()
+	virtual void OnRep_Defense(const FGameplayAttributeData& OldDefense);
+
+	UFUNCTION()
+	virtual void OnRep_NeonResistance(const FGameplayAttributeData& OldNeonResistance);
+
+	/** Writes the quantized values into Health/MaxHealth and fires the usual attribute change delegates */
+	UFUNCTION()
+	virtual void OnRep_QuantizedHealth();
+
+private:
+	/** Marks the replicated property backing an attribute dirty */
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute);
+
+	/** Copies Health/MaxHealth into QuantizedHealth and marks it dirty if it changed */
+	void UpdateQuantizedHealth();
 };
\ No newline at end of file
@@ -0,0 +1,332 @@
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "NeonProjectileKernel.h"
+#include "NeonGameplayTags.h"
+#include "NeonCombatLog.h"
+#include "NeonDamageExecCalculation.h"
+#include "GameplayEffect.h"
+#include "UObject/Package.h"
+
+/**
+ * Developer-only combat microbenchmarks, run from the console.
+ * Not compiled into shipping builds.
+ */
+#if !UE_BUILD_SHIPPING
+
+namespace NeonCombatBenchmarks
+{
+	// ========================================
+	// Projectile Kernel Benchmark
+	// ========================================
+
+	/** Projectile counts measured by Neon.Bench.ProjectileKernel */
+	static const int32 KernelBenchCounts[] = { 100, 1000, 10000 };
+
+	/** Fixed step used by the kernel benchmark (60 Hz) */
+	static constexpr float KernelBenchDeltaTime = 1.f / 60.f;
+
+	/**
+	 * Stand-in for the old per-actor path: one heap object per projectile, double-precision
+	 * FVectors, and the same math the old ANeonProjectile::Tick + homing movement component did
+	 * (two FVector::Dist square roots and a normalized homing direction per projectile per frame).
+	 * The padding approximates the distance between hot fields in a real actor.
+	 */
+	struct FLegacyProjectile
+	{
+		FVector Location;
+		uint8 ActorPadding[192];
+		FVector Velocity;
+		FVector StartLocation;
+		const FVector* OwnerLocation = nullptr;
+		float MaxTravelDistance = 1000.f;
+		float MaxSpeed = 2000.f;
+		bool bReturning = false;
+		bool bAlive = true;
+	};
+
+	/** SoA storage for the kernel variants */
+	struct FKernelBenchData
+	{
+		TArray<float> PosX, PosY, PosZ, VelX, VelY, VelZ, StartX, StartY, StartZ;
+		TArray<float> MaxDistanceSq, MaxSpeed, HomingAcceleration, CatchRadiusSq;
+		TArray<float> TargetX, TargetY, TargetZ, BoomerangMask, ReturningMask;
+		TArray<uint8> Phase;
+
+		FNeonProjectileKernelStreams MakeStreams()
+		{
+			FNeonProjectileKernelStreams Streams;
+			Streams.Num = PosX.Num();
+			Streams.PosX = PosX.GetData(); Streams.PosY = PosY.GetData(); Streams.PosZ = PosZ.GetData();
+			Streams.VelX = VelX.GetData(); Streams.VelY = VelY.GetData(); Streams.VelZ = VelZ.GetData();
+			Streams.Phase = Phase.GetData();
+			Streams.StartX = StartX.GetData(); Streams.StartY = StartY.GetData(); Streams.StartZ = StartZ.GetData();
+			Streams.MaxDistanceSq = MaxDistanceSq.GetData();
+			Streams.MaxSpeed = MaxSpeed.GetData();
+			Streams.HomingAcceleration = HomingAcceleration.GetData();
+			Streams.CatchRadiusSq = CatchRadiusSq.GetData();
+			Streams.TargetX = TargetX.GetData(); Streams.TargetY = TargetY.GetData(); Streams.TargetZ = TargetZ.GetData();
+			Streams.BoomerangMask = BoomerangMask.GetData();
+			Streams.ReturningMask = ReturningMask.GetData();
+			return Streams;
+		}
+	};
+
+	/**
+	 * One legacy-style update: distance checks with square roots, homing via GetSafeNormal.
+	 */
+	static void StepLegacyProjectile(FLegacyProjectile& Projectile, float DeltaTime)
+	{
+		if (!Projectile.bAlive)
+		{
+			return;
+		}
+
+		if (!Projectile.bReturning)
+		{
+			if (FVector::Dist(Projectile.StartLocation, Projectile.Location) >= Projectile.MaxTravelDistance)
+			{
+				Projectile.bReturning = true;
+			}
+		}
+		else
+		{
+			if (FVector::Dist(Projectile.Location, *Projectile.OwnerLocation) < 100.f)
+			{
+				Projectile.bAlive = false;
+				return;
+			}
+
+			const FVector HomingAccel = (*Projectile.OwnerLocation - Projectile.Location).GetSafeNormal() * 8000.f;
+			Projectile.Velocity = (Projectile.Velocity + HomingAccel * DeltaTime).GetClampedToMaxSize(Projectile.MaxSpeed);
+		}
+
+		Projectile.Location += Projectile.Velocity * DeltaTime;
+	}
+
+	/**
+	 * Runs the three variants at one projectile count and logs the per-projectile cost.
+	 */
+	static void RunKernelBenchmark(int32 NumProjectiles, int32 NumSteps)
+	{
+		FRandomStream Random(1234);
+
+		// A few casters shared by all projectiles, like a real encounter
+		const int32 NumOwners = FMath::Max(1, NumProjectiles / 10);
+		TArray<FVector> OwnerLocations;
+		for (int32 OwnerIdx = 0; OwnerIdx < NumOwners; ++OwnerIdx)
+		{
+			OwnerLocations.Add(FVector(Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-5000.f, 5000.f), 100.f));
+		}
+
+		// ========================================
+		// Build Identical Starting States
+		// ========================================
+		TArray<FLegacyProjectile*> Legacy;
+		FKernelBenchData Data;
+
+		for (int32 Index = 0; Index < NumProjectiles; ++Index)
+		{
+			const int32 OwnerIdx = Random.RandHelper(NumOwners);
+			const FVector Start = OwnerLocations[OwnerIdx];
+			const FVector Velocity = Random.GetUnitVector().GetSafeNormal2D() * 2000.f;
+			const FVector Location = Start + Velocity.GetSafeNormal() * Random.FRandRange(0.f, 900.f);
+			const bool bReturning = (Index % 2) == 1;
+
+			FLegacyProjectile* Projectile = new FLegacyProjectile();
+			Projectile->Location = Location;
+			Projectile->Velocity = Velocity;
+			Projectile->StartLocation = Start;
+			Projectile->OwnerLocation = &OwnerLocations[OwnerIdx];
+			Projectile->bReturning = bReturning;
+			Legacy.Add(Projectile);
+
+			Data.PosX.Add(Location.X); Data.PosY.Add(Location.Y); Data.PosZ.Add(Location.Z);
+			Data.VelX.Add(Velocity.X); Data.VelY.Add(Velocity.Y); Data.VelZ.Add(Velocity.Z);
+			Data.StartX.Add(Start.X); Data.StartY.Add(Start.Y); Data.StartZ.Add(Start.Z);
+			Data.MaxDistanceSq.Add(FMath::Square(1000.f));
+			Data.MaxSpeed.Add(2000.f);
+			Data.HomingAcceleration.Add(8000.f);
+			Data.CatchRadiusSq.Add(FMath::Square(100.f));
+			Data.TargetX.Add(Start.X); Data.TargetY.Add(Start.Y); Data.TargetZ.Add(Start.Z);
+			Data.BoomerangMask.Add(1.f);
+			Data.ReturningMask.Add(bReturning ? 1.f : 0.f);
+			Data.Phase.Add(bReturning ? 1 : 0);
+		}
+
+		// Actors are scattered in memory - shuffle so traversal order doesn't match allocation order
+		for (int32 Index = Legacy.Num() - 1; Index > 0; --Index)
+		{
+			Legacy.Swap(Index, Random.RandHelper(Index + 1));
+		}
+
+		FKernelBenchData ScalarData = Data;
+		FNeonProjectileKernelStreams ScalarStreams = ScalarData.MakeStreams();
+		FNeonProjectileKernelStreams SimdStreams = Data.MakeStreams();
+
+		TArray<int32> ReturnSlots;
+		TArray<int32> CaughtSlots;
+		ReturnSlots.Reserve(NumProjectiles);
+		CaughtSlots.Reserve(NumProjectiles);
+
+		// ========================================
+		// Per-actor Path
+		// ========================================
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			for (FLegacyProjectile* Projectile : Legacy)
+			{
+				StepLegacyProjectile(*Projectile, KernelBenchDeltaTime);
+			}
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+		// ========================================
+		// SoA Scalar Kernel
+		// ========================================
+		const double ScalarStart = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			ReturnSlots.Reset();
+			CaughtSlots.Reset();
+			NeonProjectileKernel::StepScalar(ScalarStreams, 0, ScalarStreams.Num, KernelBenchDeltaTime, ReturnSlots, CaughtSlots);
+		}
+		const double ScalarSeconds = FPlatformTime::Seconds() - ScalarStart;
+
+		// ========================================
+		// SoA SIMD Kernel
+		// ========================================
+		const double SimdStart = FPlatformTime::Seconds();
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			ReturnSlots.Reset();
+			CaughtSlots.Reset();
+			NeonProjectileKernel::StepSimd(SimdStreams, KernelBenchDeltaTime, ReturnSlots, CaughtSlots);
+		}
+		const double SimdSeconds = FPlatformTime::Seconds() - SimdStart;
+
+		for (FLegacyProjectile* Projectile : Legacy)
+		{
+			delete Projectile;
+		}
+
+		// ========================================
+		// Report
+		// ========================================
+		const double Updates = static_cast<double>(NumProjectiles) * NumSteps;
+		const double LegacyNs = LegacySeconds * 1.0e9 / Updates;
+		const double ScalarNs = ScalarSeconds * 1.0e9 / Updates;
+		const double SimdNs = SimdSeconds * 1.0e9 / Updates;
+
+		UE_LOG(LogNeonBench, Display,
+			TEXT("ProjectileKernel N=%6d | per-actor %7.2f ns | SoA scalar %7.2f ns (%.1fx) | SoA SIMD %7.2f ns (%.1fx)"),
+			NumProjectiles,
+			LegacyNs,
+			ScalarNs, LegacyNs / FMath::Max(ScalarNs, UE_DOUBLE_SMALL_NUMBER),
+			SimdNs, LegacyNs / FMath::Max(SimdNs, UE_DOUBLE_SMALL_NUMBER));
+	}
+
+	/**
+	 * Neon.Bench.ProjectileKernel [Steps]
+	 */
+	static FAutoConsoleCommand ProjectileKernelBenchCommand(
+		TEXT("Neon.Bench.ProjectileKernel"),
+		TEXT("Compares the per-actor projectile update against the SoA scalar and SIMD kernels at 100, 1k and 10k projectiles. Optional arg: number of 60 Hz steps (default 600)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 NumSteps = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 600;
+
+			for (const int32 NumProjectiles : KernelBenchCounts)
+			{
+				RunKernelBenchmark(NumProjectiles, NumSteps);
+			}
+		})
+	);
+
+	// ========================================
+	// Damage Exec Tag Benchmark
+	// ========================================
+
+	/**
+	 * Tag work the damage exec used to do per execution: copy all asset tags into a
+	 * fresh container and resolve three tags by name.
+	 */
+	static bool LegacyExecTagWork(const FGameplayEffectSpec& Spec, float& OutDamage)
+	{
+		FGameplayTagContainer AssetTags;
+		Spec.GetAllAssetTags(AssetTags);
+
+		const FGameplayTag StatusCorrupted = FGameplayTag::RequestGameplayTag(FName("Status.Corrupted"));
+		const FGameplayTag DamageNeon = FGameplayTag::RequestGameplayTag(FName("Damage.Type.Neon"));
+		const FGameplayTag DataDamage = FGameplayTag::RequestGameplayTag(FName("Data.Damage"));
+
+		OutDamage = Spec.GetSetByCallerMagnitude(DataDamage, false, -1.0f);
+		return StatusCorrupted.IsValid() && AssetTags.HasTag(DamageNeon);
+	}
+
+	/**
+	 * The same work with native tags and in-place asset tag checks.
+	 */
+	static bool CachedExecTagWork(const FGameplayEffectSpec& Spec, float& OutDamage)
+	{
+		OutDamage = Spec.GetSetByCallerMagnitude(NeonGameplayTags::Data_Damage, false, -1.0f);
+		return NeonGameplayTags::Status_Corrupted.GetTag().IsValid()
+			&& UNeonDamageExecCalculation::SpecHasAssetTag(Spec, NeonGameplayTags::Damage_Type_Neon);
+	}
+
+	/**
+	 * Neon.Bench.DamageExec [Executions]
+	 *
+	 * Measures only the tag handling part of UNeonDamageExecCalculation::Execute_Implementation
+	 * (the part that changed); attribute capture and modifier output are identical in both paths.
+	 */
+	static FAutoConsoleCommand DamageExecBenchCommand(
+		TEXT("Neon.Bench.DamageExec"),
+		TEXT("Compares per-execution tag handling in the damage exec: name lookups + asset tag copy vs native tags. Optional arg: number of executions (default 1000000)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const int32 NumExecutions = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+
+			// A Neon damage spec like the ones abilities build
+			UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage());
+			FGameplayEffectSpec Spec(Effect, FGameplayEffectContextHandle(new FGameplayEffectContext()), 1.f);
+			Spec.AddDynamicAssetTag(NeonGameplayTags::Damage_Type_Neon);
+			Spec.SetSetByCallerMagnitude(NeonGameplayTags::Data_Damage, 25.f);
+
+			int32 LegacyMatches = 0;
+			int32 CachedMatches = 0;
+			float DamageSum = 0.f;
+			float Damage = 0.f;
+
+			const double LegacyStart = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumExecutions; ++Index)
+			{
+				LegacyMatches += LegacyExecTagWork(Spec, Damage) ? 1 : 0;
+				DamageSum += Damage;
+			}
+			const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+			const double CachedStart = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < NumExecutions; ++Index)
+			{
+				CachedMatches += CachedExecTagWork(Spec, Damage) ? 1 : 0;
+				DamageSum += Damage;
+			}
+			const double CachedSeconds = FPlatformTime::Seconds() - CachedStart;
+
+			const double LegacyPerSecond = NumExecutions / FMath::Max(LegacySeconds, UE_DOUBLE_SMALL_NUMBER);
+			const double CachedPerSecond = NumExecutions / FMath::Max(CachedSeconds, UE_DOUBLE_SMALL_NUMBER);
+
+			UE_LOG(LogNeonBench, Display,
+				TEXT("DamageExec tags N=%d | RequestGameplayTag + copy %.2f M exec/s | native tags %.2f M exec/s (%.1fx) | matches %d/%d, checksum %.0f"),
+				NumExecutions,
+				LegacyPerSecond / 1.0e6,
+				CachedPerSecond / 1.0e6,
+				CachedPerSecond / FMath::Max(LegacyPerSecond, UE_DOUBLE_SMALL_NUMBER),
+				LegacyMatches, CachedMatches, DamageSum);
+		})
+	);
+}
+
+#endif // !UE_BUILD_SHIPPING
\ No newline at end of file
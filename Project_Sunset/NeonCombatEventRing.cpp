@@ -0,0 +1,217 @@
+#include "NeonCombatEventRing.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+
+/** Record kinds in a capture file */
+enum class ENeonCombatRecord : uint8
+{
+	Tag,
+	Event
+};
+
+// ========================================
+// FNeonCombatEvent
+// ========================================
+
+/**
+ * Null actors leave the matching id at 0.
+ */
+void FNeonCombatEvent::SetActors(AActor* InSource, AActor* InTarget)
+{
+	Source = InSource;
+	Target = InTarget;
+	SourceId = InSource ? InSource->GetUniqueID() : 0;
+	TargetId = InTarget ? InTarget->GetUniqueID() : 0;
+}
+
+// ========================================
+// FNeonCombatEventRing
+// ========================================
+
+/**
+ * Power-of-two capacity so a slot index is a mask, not a modulo.
+ */
+FNeonCombatEventRing::FNeonCombatEventRing(uint32 InCapacity)
+	: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u)))
+{
+	Mask = Capacity - 1;
+	Slots = MakeUnique<FSlot[]>(Capacity);
+}
+
+/**
+ * Claims a sequence number, hides the slot from readers while it is filled, then publishes it.
+ */
+void FNeonCombatEventRing::Write(const FNeonCombatEvent& Event)
+{
+	const uint64 Sequence = WriteCursor.fetch_add(1, std::memory_order_relaxed);
+	FSlot& Slot = Slots[Sequence & Mask];
+
+	Slot.Published.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Slot.Event = Event;
+
+	Slot.Published.store(Sequence + 1, std::memory_order_release);
+}
+
+/**
+ * Starts at the current write position.
+ */
+FNeonCombatEventCursor FNeonCombatEventRing::MakeCursor() const
+{
+	FNeonCombatEventCursor Cursor;
+	Cursor.Next = WriteCursor.load(std::memory_order_acquire);
+	return Cursor;
+}
+
+/**
+ * Starts one lap behind the write position (or at 0 before the first lap).
+ */
+FNeonCombatEventCursor FNeonCombatEventRing::MakeOldestCursor() const
+{
+	const uint64 Written = WriteCursor.load(std::memory_order_acquire);
+
+	FNeonCombatEventCursor Cursor;
+	Cursor.Next = Written > Capacity ? Written - Capacity : 0;
+	return Cursor;
+}
+
+/**
+ * Skips ahead if the cursor was lapped, then visits published slots in order.
+ * Each event is copied out and the slot's sequence re-checked before the visitor sees it, so a copy a
+ * writer overwrote mid-read is dropped instead of handed out torn.
+ */
+int32 FNeonCombatEventRing::Read(FNeonCombatEventCursor& Cursor, TFunctionRef<void(const FNeonCombatEvent&)> Visitor) const
+{
+	const uint64 End = WriteCursor.load(std::memory_order_acquire);
+
+	if (End - Cursor.Next > Capacity)
+	{
+		Cursor.Dropped += End - Capacity - Cursor.Next;
+		Cursor.Next = End - Capacity;
+	}
+
+	int32 NumVisited = 0;
+	for (; Cursor.Next < End; ++Cursor.Next)
+	{
+		const FSlot& Slot = Slots[Cursor.Next & Mask];
+		if (Slot.Published.load(std::memory_order_acquire) != Cursor.Next + 1)
+		{
+			// Still being written (or already overwritten - the next call skips ahead)
+			break;
+		}
+
+		const FNeonCombatEvent Event = Slot.Event;
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Published.load(std::memory_order_acquire) != Cursor.Next + 1)
+		{
+			// Lapped while copying
+			++Cursor.Dropped;
+			continue;
+		}
+
+		Visitor(Event);
+		++NumVisited;
+	}
+
+	return NumVisited;
+}
+
+// ========================================
+// FNeonCombatEventWriter
+// ========================================
+
+/**
+ * Closes the file if the owner didn't.
+ */
+FNeonCombatEventWriter::~FNeonCombatEventWriter()
+{
+	Close();
+}
+
+/**
+ * Starts a fresh file; tags are re-announced because the tag table is per file.
+ */
+bool FNeonCombatEventWriter::Open(const FString& Path)
+{
+	Close();
+
+	Archive.Reset(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Archive.IsValid())
+	{
+		return false;
+	}
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	*Archive << Magic;
+	*Archive << Version;
+
+	TagIndices.Reset();
+	NumEvents = 0;
+	return true;
+}
+
+/**
+ * Ids, not pointers - the file outlives the actors.
+ */
+void FNeonCombatEventWriter::Write(const FNeonCombatEvent& Event)
+{
+	if (!Archive.IsValid())
+	{
+		return;
+	}
+
+	int32 TagIndex = GetTagIndex(Event.Tag);
+
+	uint8 Kind = static_cast<uint8>(ENeonCombatRecord::Event);
+	uint8 Type = static_cast<uint8>(Event.Type);
+	uint8 Detail = Event.Detail;
+	double Time = Event.Time;
+	uint32 SourceId = Event.SourceId;
+	uint32 TargetId = Event.TargetId;
+	float Magnitude = Event.Magnitude;
+
+	FArchive& Ar = *Archive;
+	Ar << Kind << Type << Detail << Time << SourceId << TargetId << Magnitude << TagIndex;
+
+	++NumEvents;
+}
+
+/**
+ * Safe to call on a closed writer.
+ */
+void FNeonCombatEventWriter::Close()
+{
+	if (Archive.IsValid())
+	{
+		Archive->Close();
+		Archive.Reset();
+	}
+}
+
+/**
+ * Empty tags are index -1 and never written.
+ */
+int32 FNeonCombatEventWriter::GetTagIndex(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Existing = TagIndices.Find(Tag))
+	{
+		return *Existing;
+	}
+
+	int32 Index = TagIndices.Num();
+	TagIndices.Add(Tag, Index);
+
+	uint8 Kind = static_cast<uint8>(ENeonCombatRecord::Tag);
+	FString Name = Tag.ToString();
+	*Archive << Kind << Index << Name;
+
+	return Index;
+}
\ No newline at end of file
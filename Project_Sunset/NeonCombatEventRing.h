@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include <atomic>
+
+// Forward declarations
+class AActor;
+
+/**
+ * Kind of combat event recorded in FNeonCombatEventRing.
+ * Values are written to capture files - append new kinds, never reorder.
+ */
+enum class ENeonCombatEventType : uint8
+{
+	/** Damage applied to a target (Magnitude = damage, Tag = damage type) */
+	Damage,
+
+	/** Damage exec fired one or more combos (Magnitude = damage after combos, Detail = number of combos) */
+	Combo,
+
+	/** Corruption applied by an outgoing boomerang (Tag = status tag) */
+	Corruption,
+
+	/** Boomerang changed phase (Detail = new EProjectilePhase, Magnitude = distance to owner) */
+	BoomerangPhase,
+
+	/** Boomerang was caught by its owner (Magnitude = distance to owner) */
+	BoomerangCaught
+};
+
+/**
+ * One recorded combat event. Trivially copyable so producers write it with a plain assignment.
+ */
+struct FNeonCombatEvent
+{
+	/** World time the event happened */
+	double Time = 0.0;
+
+	/** Responsible actor (instigator / projectile owner), weak so the ring keeps nothing alive */
+	TWeakObjectPtr<AActor> Source;
+
+	/** Affected actor (damaged target, projectile for phase events) */
+	TWeakObjectPtr<AActor> Target;
+
+	/** Source's UObject unique id, stable in capture files after the actor is gone */
+	uint32 SourceId = 0;
+
+	/** Target's UObject unique id */
+	uint32 TargetId = 0;
+
+	/** Meaning depends on Type */
+	float Magnitude = 0.f;
+
+	/** Meaning depends on Type (may be empty) */
+	FGameplayTag Tag;
+
+	ENeonCombatEventType Type = ENeonCombatEventType::Damage;
+
+	/** Small per-type payload (combo count, projectile phase) */
+	uint8 Detail = 0;
+
+	/** Fills Source/Target and their ids */
+	void SetActors(AActor* InSource, AActor* InTarget);
+};
+
+/**
+ * Read position of one consumer. Each reader keeps its own cursor, so readers never affect each other.
+ */
+struct FNeonCombatEventCursor
+{
+	/** Sequence number of the next event to read */
+	uint64 Next = 0;
+
+	/** Events this reader missed because producers lapped it */
+	uint64 Dropped = 0;
+};
+
+/**
+ * Fixed-capacity, lock-free ring of combat events.
+ *
+ * - Writers claim a slot with a single atomic increment and publish it by storing the slot's
+ *   sequence number, so any thread can record without taking a lock
+ * - Readers walk their own cursor, copy each event out and re-check the slot's sequence before visiting
+ *   it, so an event overwritten mid-read is dropped rather than seen torn; a reader that falls more than
+ *   Capacity behind skips ahead and counts what it dropped
+ * - Old events are overwritten, so memory use never grows during long runs
+ *
+ * Readers are expected to consume on the game thread every frame or so.
+ */
+class PROJECT_SUNSET_API FNeonCombatEventRing
+{
+public:
+	/** @param InCapacity - Number of slots, rounded up to a power of two */
+	explicit FNeonCombatEventRing(uint32 InCapacity);
+
+	/** Records one event (any thread) */
+	void Write(const FNeonCombatEvent& Event);
+
+	/** Cursor that starts at the next event written (sees only new events) */
+	FNeonCombatEventCursor MakeCursor() const;
+
+	/** Cursor that starts at the oldest event still in the ring */
+	FNeonCombatEventCursor MakeOldestCursor() const;
+
+	/**
+	 * Visits every published event after the cursor and advances it.
+	 * Stops early at a slot a writer is still filling; it is picked up on the next call.
+	 * The visitor gets a validated copy, valid only for the duration of the call.
+	 *
+	 * @return Number of events visited
+	 */
+	int32 Read(FNeonCombatEventCursor& Cursor, TFunctionRef<void(const FNeonCombatEvent&)> Visitor) const;
+
+	/** Total events ever written */
+	uint64 GetNumWritten() const { return WriteCursor.load(std::memory_order_acquire); }
+
+	uint32 GetCapacity() const { return Capacity; }
+
+private:
+	struct FSlot
+	{
+		/** Sequence + 1 of the event in the slot once published, 0 while it is being written */
+		std::atomic<uint64> Published { 0 };
+
+		FNeonCombatEvent Event;
+	};
+
+	TUniquePtr<FSlot[]> Slots;
+	uint32 Capacity = 0;
+	uint32 Mask = 0;
+
+	/** Sequence number handed to the next writer */
+	std::atomic<uint64> WriteCursor { 0 };
+};
+
+/**
+ * Writes combat events to a binary capture file.
+ *
+ * Layout: a header (magic, version), then a stream of records each starting with a record kind byte:
+ * a tag record (index, tag name) the first time a tag is used, then event records referencing tags by index.
+ * Records are appended as they arrive, so the same format works for one-off dumps and for streaming a soak run.
+ */
+class PROJECT_SUNSET_API FNeonCombatEventWriter
+{
+public:
+	/** 'NCEV' */
+	static constexpr uint32 FileMagic = 0x5645434E;
+	static constexpr uint32 FileVersion = 1;
+
+	~FNeonCombatEventWriter();
+
+	/** Creates (or truncates) the file and writes the header */
+	bool Open(const FString& Path);
+
+	/** Appends one event */
+	void Write(const FNeonCombatEvent& Event);
+
+	/** Flushes and closes the file */
+	void Close();
+
+	bool IsOpen() const { return Archive.IsValid(); }
+
+	uint64 GetNumEventsWritten() const { return NumEvents; }
+
+private:
+	/** Index of the tag in the file's tag table, writing a tag record first if it is new */
+	int32 GetTagIndex(const FGameplayTag& Tag);
+
+	TUniquePtr<FArchive> Archive;
+	TMap<FGameplayTag, int32> TagIndices;
+	uint64 NumEvents = 0;
+};
\ No newline at end of file
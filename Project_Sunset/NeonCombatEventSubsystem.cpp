@@ -0,0 +1,254 @@
+#include "NeonCombatEventSubsystem.h"
+#include "NeonCombatLog.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+
+static TAutoConsoleVariable<int32> CVarNeonCombatEventsCapacity(
+	TEXT("neon.CombatEvents.Capacity"),
+	16384,
+	TEXT("Number of combat events kept per world (rounded up to a power of two). Read when a world starts."),
+	ECVF_Default
+);
+
+/**
+ * Default capture path: Saved/CombatEvents/<Name>_<timestamp>.ncev
+ */
+static FString MakeCombatEventPath(const TCHAR* Name)
+{
+	const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("CombatEvents"), FString::Printf(TEXT("%s_%s.ncev"), Name, *Stamp));
+}
+
+// ========================================
+// Events
+// ========================================
+
+/**
+ * Damage is always recorded; the delegate is skipped entirely when nothing subscribed.
+ */
+void UNeonCombatEventSubsystem::BroadcastDamage(const FNeonDamageEvent& Event)
+{
+	RecordEvent(ENeonCombatEventType::Damage, Event.Instigator, Event.Target, Event.Amount, Event.DamageType);
+
+	if (AnyDamageEvent.IsBound())
+	{
+		AnyDamageEvent.Broadcast(Event);
+	}
+}
+
+/**
+ * Builds the event on the stack and hands it to the ring (one slot claim, one copy).
+ */
+void UNeonCombatEventSubsystem::RecordEvent(ENeonCombatEventType Type, AActor* Source, AActor* Target, float Magnitude,
+	const FGameplayTag& Tag, uint8 Detail)
+{
+	FNeonCombatEvent Event;
+	Event.Time = GetWorld()->GetTimeSeconds();
+	Event.SetActors(Source, Target);
+	Event.Magnitude = Magnitude;
+	Event.Tag = Tag;
+	Event.Type = Type;
+	Event.Detail = Detail;
+
+	EventRing->Write(Event);
+}
+
+// ========================================
+// Export
+// ========================================
+
+/**
+ * Oldest to newest; events written while exporting are left out.
+ */
+int32 UNeonCombatEventSubsystem::ExportEvents(const FString& Path) const
+{
+	FNeonCombatEventWriter Writer;
+	if (!Writer.Open(Path))
+	{
+		return INDEX_NONE;
+	}
+
+	FNeonCombatEventCursor Cursor = EventRing->MakeOldestCursor();
+	EventRing->Read(Cursor, [&Writer](const FNeonCombatEvent& Event)
+	{
+		Writer.Write(Event);
+	});
+
+	Writer.Close();
+	return static_cast<int32>(Writer.GetNumEventsWritten());
+}
+
+/**
+ * The capture starts with the next event; call ExportEvents first to also keep the history.
+ */
+bool UNeonCombatEventSubsystem::StartCapture(const FString& Path)
+{
+	StopCapture();
+
+	if (!CaptureWriter.Open(Path))
+	{
+		return false;
+	}
+
+	CaptureCursor = EventRing->MakeCursor();
+	return true;
+}
+
+/**
+ * Reports how many events didn't make it (capture fell a whole ring behind).
+ */
+void UNeonCombatEventSubsystem::StopCapture()
+{
+	if (!CaptureWriter.IsOpen())
+	{
+		return;
+	}
+
+	DrainCapture();
+
+	NEON_COMBAT_LOG(Log, TEXT("CombatEvents: capture stopped (%llu events written, %llu dropped)"),
+		CaptureWriter.GetNumEventsWritten(), CaptureCursor.Dropped);
+
+	CaptureWriter.Close();
+}
+
+/**
+ * Appends the events published since the last drain.
+ */
+void UNeonCombatEventSubsystem::DrainCapture()
+{
+	EventRing->Read(CaptureCursor, [this](const FNeonCombatEvent& Event)
+	{
+		CaptureWriter.Write(Event);
+	});
+}
+
+// ========================================
+// Tick
+// ========================================
+
+/**
+ * Nothing to do between captures.
+ */
+bool UNeonCombatEventSubsystem::IsTickable() const
+{
+	return CaptureWriter.IsOpen();
+}
+
+/**
+ * Drains once per frame, well before a default-sized ring could lap the capture.
+ */
+void UNeonCombatEventSubsystem::Tick(float DeltaTime)
+{
+	DrainCapture();
+}
+
+TStatId UNeonCombatEventSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNeonCombatEventSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================
+// Lifetime
+// ========================================
+
+/**
+ * Allocates the ring up front so recording never allocates.
+ */
+void UNeonCombatEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	EventRing = MakeUnique<FNeonCombatEventRing>(static_cast<uint32>(FMath::Max(CVarNeonCombatEventsCapacity.GetValueOnGameThread(), 2)));
+}
+
+/**
+ * Finishes a running capture and drops listeners with the world.
+ */
+void UNeonCombatEventSubsystem::Deinitialize()
+{
+	StopCapture();
+	AnyDamageEvent.Clear();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds run combat.
+ */
+bool UNeonCombatEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ========================================
+// Console Commands
+// ========================================
+
+namespace NeonCombatEventCommands
+{
+	/** Subsystem of the command's world, logging an error if there is none */
+	static UNeonCombatEventSubsystem* GetSubsystem(UWorld* World)
+	{
+		UNeonCombatEventSubsystem* Events = World ? World->GetSubsystem<UNeonCombatEventSubsystem>() : nullptr;
+		if (!Events)
+		{
+			NEON_COMBAT_LOG(Error, TEXT("CombatEvents: needs a game world (run with -game or in PIE)"));
+		}
+		return Events;
+	}
+
+	/**
+	 * neon.CombatEvents.Export [File]
+	 */
+	static FAutoConsoleCommandWithWorldAndArgs ExportCommand(
+		TEXT("neon.CombatEvents.Export"),
+		TEXT("Writes the combat events still in the ring to a binary capture file. Args: [File] (default Saved/CombatEvents/Export_<time>.ncev)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UNeonCombatEventSubsystem* Events = GetSubsystem(World))
+			{
+				const FString Path = Args.Num() > 0 ? Args[0] : MakeCombatEventPath(TEXT("Export"));
+				const int32 NumWritten = Events->ExportEvents(Path);
+				if (NumWritten == INDEX_NONE)
+				{
+					NEON_COMBAT_LOG(Error, TEXT("CombatEvents: failed to write %s"), *Path);
+				}
+				else
+				{
+					NEON_COMBAT_LOG(Log, TEXT("CombatEvents: %d events written to %s"), NumWritten, *Path);
+				}
+			}
+		})
+	);
+
+	/**
+	 * neon.CombatEvents.Capture [File|Stop]
+	 */
+	static FAutoConsoleCommandWithWorldAndArgs CaptureCommand(
+		TEXT("neon.CombatEvents.Capture"),
+		TEXT("Streams every new combat event to a binary capture file (for soak runs). Args: [File] (default Saved/CombatEvents/Capture_<time>.ncev) or Stop."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UNeonCombatEventSubsystem* Events = GetSubsystem(World))
+			{
+				if (Args.Num() > 0 && Args[0] == TEXT("Stop"))
+				{
+					Events->StopCapture();
+					return;
+				}
+
+				const FString Path = Args.Num() > 0 ? Args[0] : MakeCombatEventPath(TEXT("Capture"));
+				if (Events->StartCapture(Path))
+				{
+					NEON_COMBAT_LOG(Log, TEXT("CombatEvents: capturing to %s"), *Path);
+				}
+				else
+				{
+					NEON_COMBAT_LOG(Error, TEXT("CombatEvents: failed to create %s"), *Path);
+				}
+			}
+		})
+	);
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonAttributeSet.h"
+#include "NeonCombatEventRing.h"
+#include "NeonCombatEventSubsystem.generated.h"
+
+/**
+ * World-wide combat event stream.
+ *
+ * Two ways to consume combat from one place instead of binding to every pawn:
+ * - OnAnyDamage() - native delegate fired synchronously for every damage event (costs an IsBound() check when unused)
+ * - The event ring - every damage, combo, corruption and boomerang phase event, timestamped and kept for the last
+ *   neon.CombatEvents.Capacity events. Readers (damage numbers, AI threat, telemetry) keep a cursor and read
+ *   the events in place once per frame.
+ *
+ * Listeners that care about one target bind to that target's UNeonAttributeSet::OnDamageTakenNative instead.
+ *
+ * The ring can be dumped (neon.CombatEvents.Export) or streamed to disk for a whole soak run
+ * (neon.CombatEvents.Capture) in the FNeonCombatEventWriter binary format.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonCombatEventSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Damage applied to any attribute set in this world */
+	FOnNeonDamageNative& OnAnyDamage() { return AnyDamageEvent; }
+
+	/** Forwards one damage event to the world listeners and records it (called by UNeonAttributeSet) */
+	void BroadcastDamage(const FNeonDamageEvent& Event);
+
+	/**
+	 * Records one event in the ring, stamped with the current world time. Safe to call from any thread.
+	 *
+	 * @param Type - Event kind (decides what Magnitude/Tag/Detail mean)
+	 * @param Source - Responsible actor (may be null)
+	 * @param Target - Affected actor (may be null)
+	 */
+	void RecordEvent(ENeonCombatEventType Type, AActor* Source, AActor* Target, float Magnitude,
+		const FGameplayTag& Tag = FGameplayTag(), uint8 Detail = 0);
+
+	/** Ring for readers (make a cursor, then Read() once per frame) */
+	const FNeonCombatEventRing& GetEventRing() const { return *EventRing; }
+
+	/**
+	 * Writes every event still in the ring to a capture file.
+	 *
+	 * @return Number of events written, or INDEX_NONE if the file couldn't be created
+	 */
+	int32 ExportEvents(const FString& Path) const;
+
+	/** Streams every new event to Path until StopCapture (replaces a running capture) */
+	bool StartCapture(const FString& Path);
+
+	/** Flushes the remaining events and closes the capture file */
+	void StopCapture();
+
+	// ========================================
+	// FTickableGameObject Interface
+	// ========================================
+
+	/** Only ticks while a capture is running */
+	virtual bool IsTickable() const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// USubsystem Interface
+	// ========================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds run combat */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Writes everything published since the capture cursor */
+	void DrainCapture();
+
+	/** Listeners for every damage event in the world */
+	FOnNeonDamageNative AnyDamageEvent;
+
+	/** Recorded events (created in Initialize, sized from neon.CombatEvents.Capacity) */
+	TUniquePtr<FNeonCombatEventRing> EventRing;
+
+	/** Open while a capture is running */
+	FNeonCombatEventWriter CaptureWriter;
+
+	/** Capture's read position in the ring */
+	FNeonCombatEventCursor CaptureCursor;
+};
\ No newline at end of file
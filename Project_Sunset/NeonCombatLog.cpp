@@ -0,0 +1,18 @@
+#include "NeonCombatLog.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogNeonCombat);
+DEFINE_LOG_CATEGORY(LogNeonBench);
+
+#if NEON_COMBAT_DIAGNOSTICS
+
+bool GNeonCombatVerboseLog = false;
+
+static FAutoConsoleVariableRef CVarNeonCombatVerboseLog(
+	TEXT("neon.Combat.VerboseLog"),
+	GNeonCombatVerboseLog,
+	TEXT("Prints per-hit combat diagnostics (damage, combos, projectile phases) to LogNeonCombat. Not available in Test/Shipping builds."),
+	ECVF_Cheat
+);
+
+#endif // NEON_COMBAT_DIAGNOSTICS
\ No newline at end of file
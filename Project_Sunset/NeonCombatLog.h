@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Logging for combat code (projectiles, damage, attributes).
+ *
+ * Two levels of output:
+ * - NEON_COMBAT_LOG(Verbosity, ...) - normal UE_LOG on LogNeonCombat. Anything above the category's
+ *   compile-time verbosity is stripped by the compiler, arguments included.
+ * - NEON_COMBAT_VERBOSE(...) - per-hit/per-frame diagnostics. Only compiled in when
+ *   NEON_COMBAT_DIAGNOSTICS is set, and only printed while neon.Combat.VerboseLog is on.
+ *   Arguments (GetName() etc.) are not evaluated while the cvar is off.
+ *
+ * Both defaults can be overridden from Project_Sunset.Build.cs (PublicDefinitions), e.g.
+ * "NEON_COMBAT_DIAGNOSTICS=1" to keep diagnostics in a Test build.
+ */
+
+/** Compile diagnostics in everywhere except Test and Shipping */
+#ifndef NEON_COMBAT_DIAGNOSTICS
+	#define NEON_COMBAT_DIAGNOSTICS !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+/** Most verbose LogNeonCombat level compiled in (Test/Shipping keep only warnings and errors) */
+#ifndef NEON_COMBAT_LOG_COMPILE_VERBOSITY
+	#if NEON_COMBAT_DIAGNOSTICS
+		#define NEON_COMBAT_LOG_COMPILE_VERBOSITY All
+	#else
+		#define NEON_COMBAT_LOG_COMPILE_VERBOSITY Warning
+	#endif
+#endif
+
+PROJECT_SUNSET_API DECLARE_LOG_CATEGORY_EXTERN(LogNeonCombat, Log, NEON_COMBAT_LOG_COMPILE_VERBOSITY);
+
+/** Output of the developer benchmarks - never stripped, they are meant to run in Test builds */
+PROJECT_SUNSET_API DECLARE_LOG_CATEGORY_EXTERN(LogNeonBench, Log, All);
+
+/** Combat log line, subject to LogNeonCombat's compile-time verbosity */
+#define NEON_COMBAT_LOG(Verbosity, Format, ...) \
+	UE_LOG(LogNeonCombat, Verbosity, Format, ##__VA_ARGS__)
+
+#if NEON_COMBAT_DIAGNOSTICS
+
+/** Mirrors neon.Combat.VerboseLog (plain bool so the check is a single load) */
+extern PROJECT_SUNSET_API bool GNeonCombatVerboseLog;
+
+/** Per-hit diagnostics, printed only while neon.Combat.VerboseLog is on */
+#define NEON_COMBAT_VERBOSE(Format, ...) \
+	do \
+	{ \
+		if (GNeonCombatVerboseLog) \
+		{ \
+			UE_LOG(LogNeonCombat, Log, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#else
+
+#define NEON_COMBAT_VERBOSE(Format, ...) do {} while (0)
+
+#endif // NEON_COMBAT_DIAGNOSTICS
\ No newline at end of file
@@ -0,0 +1,371 @@
+#include "NeonCombatPawnRegistry.h"
+#include "PlayerCharacter.h"
+#include "NeonCombatStats.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<float> CVarNeonSpatialHashCellSize(
+	TEXT("neon.Combat.SpatialHashCellSize"),
+	500.f,
+	TEXT("Cell size (world units) of the combat pawn spatial hash. Changing it rebuilds the grid on the next refresh."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarNeonRegistrySlotReuseDelay(
+	TEXT("neon.Combat.RegistrySlotReuseDelay"),
+	15.f,
+	TEXT("Seconds before a freed combat pawn slot can be handed to a new pawn. Tuning only: slot generations keep reuse correct, the delay just keeps projectiles in flight from meeting reused slots."),
+	ECVF_Default
+);
+
+// ========================================
+// Registration
+// ========================================
+
+/**
+ * Hands out a slot (reusing freed ones once their quarantine has passed) and files the pawn in the grid.
+ */
+int32 UNeonCombatPawnRegistry::RegisterPawn(APlayerCharacter* Pawn)
+{
+	if (!Pawn)
+	{
+		return INDEX_NONE;
+	}
+
+	if (Pawn->CombatRegistryIndex != INDEX_NONE)
+	{
+		return Pawn->CombatRegistryIndex;
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double ReuseDelay = CVarNeonRegistrySlotReuseDelay.GetValueOnGameThread();
+
+	int32 PawnIndex;
+	if (FreeSlotsHead < FreeSlots.Num() && Now - FreeSlotReleaseTimes[FreeSlotsHead] >= ReuseDelay)
+	{
+		// Oldest freed slot first - it's the one most likely to be out of quarantine
+		PawnIndex = FreeSlots[FreeSlotsHead++];
+
+		// Drop the consumed prefix once it outweighs the queued part, so popping stays O(1) amortized
+		if (FreeSlotsHead * 2 >= FreeSlots.Num())
+		{
+			FreeSlots.RemoveAt(0, FreeSlotsHead, EAllowShrinking::No);
+			FreeSlotReleaseTimes.RemoveAt(0, FreeSlotsHead, EAllowShrinking::No);
+			FreeSlotsHead = 0;
+		}
+	}
+	else
+	{
+		PawnIndex = Pawns.Add(nullptr);
+		AbilitySystems.Add(nullptr);
+		CenterX.Add(0.f);
+		CenterY.Add(0.f);
+		CenterZ.Add(0.f);
+		CapsuleRadius.Add(0.f);
+		CapsuleHalfHeight.Add(0.f);
+		SlotCellKeys.Add(0);
+		SlotGenerations.Add(0);
+	}
+
+	Pawns[PawnIndex] = Pawn;
+	AbilitySystems[PawnIndex] = Pawn->GetAbilitySystemComponent();
+	Pawn->CombatRegistryIndex = PawnIndex;
+	Pawn->CombatRegistryGeneration = SlotGenerations[PawnIndex];
+
+	// ========================================
+	// Initial Placement
+	// ========================================
+	const FVector Location = Pawn->GetActorLocation();
+	CenterX[PawnIndex] = Location.X;
+	CenterY[PawnIndex] = Location.Y;
+	CenterZ[PawnIndex] = Location.Z;
+
+	if (const UCapsuleComponent* Capsule = Pawn->GetCapsuleComponent())
+	{
+		float Radius = 0.f;
+		float HalfHeight = 0.f;
+		Capsule->GetScaledCapsuleSize(Radius, HalfHeight);
+		CapsuleRadius[PawnIndex] = Radius;
+		CapsuleHalfHeight[PawnIndex] = HalfHeight;
+		MaxCapsuleRadius = FMath::Max(MaxCapsuleRadius, Radius);
+	}
+
+	const int64 CellKey = MakeCellKey(WorldToCell(Location.X), WorldToCell(Location.Y));
+	SlotCellKeys[PawnIndex] = CellKey;
+	Cells.FindOrAdd(CellKey).Add(PawnIndex);
+
+	return PawnIndex;
+}
+
+/**
+ * Frees a pawn's slot.
+ */
+void UNeonCombatPawnRegistry::UnregisterPawn(APlayerCharacter* Pawn)
+{
+	if (!Pawn || Pawn->CombatRegistryIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 PawnIndex = Pawn->CombatRegistryIndex;
+	Pawn->CombatRegistryIndex = INDEX_NONE;
+
+	if (!Pawns.IsValidIndex(PawnIndex) || Pawns[PawnIndex] != Pawn)
+	{
+		return;
+	}
+
+	RemoveSlotFromCell(PawnIndex);
+
+	Pawns[PawnIndex] = nullptr;
+	AbilitySystems[PawnIndex] = nullptr;
+	++SlotGenerations[PawnIndex];
+	FreeSlots.Add(PawnIndex);
+	FreeSlotReleaseTimes.Add(GetWorld()->GetTimeSeconds());
+}
+
+// ========================================
+// Spatial Hash
+// ========================================
+
+/**
+ * Pulls fresh pawn transforms into the SoA and refiles pawns that crossed a cell border.
+ */
+void UNeonCombatPawnRegistry::RefreshSpatialHash()
+{
+	if (LastRefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastRefreshFrame = GFrameCounter;
+
+	NEON_COMBAT_SCOPE(STAT_NeonPawnHashRefresh);
+
+	// Cell size changed from the console - refile everything
+	const bool bRebuild = !FMath::IsNearlyEqual(CellSize, CVarNeonSpatialHashCellSize.GetValueOnGameThread());
+	if (bRebuild)
+	{
+		CellSize = FMath::Max(CVarNeonSpatialHashCellSize.GetValueOnGameThread(), 1.f);
+		Cells.Reset();
+	}
+
+	MaxCapsuleRadius = 0.f;
+
+	for (int32 PawnIndex = 0; PawnIndex < Pawns.Num(); ++PawnIndex)
+	{
+		const APlayerCharacter* Pawn = Pawns[PawnIndex];
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		const FVector Location = Pawn->GetActorLocation();
+		CenterX[PawnIndex] = Location.X;
+		CenterY[PawnIndex] = Location.Y;
+		CenterZ[PawnIndex] = Location.Z;
+
+		// Capsules can change size at runtime (crouching, scaling)
+		if (const UCapsuleComponent* Capsule = Pawn->GetCapsuleComponent())
+		{
+			Capsule->GetScaledCapsuleSize(CapsuleRadius[PawnIndex], CapsuleHalfHeight[PawnIndex]);
+		}
+		MaxCapsuleRadius = FMath::Max(MaxCapsuleRadius, CapsuleRadius[PawnIndex]);
+
+		if (bRebuild)
+		{
+			const int64 CellKey = MakeCellKey(WorldToCell(Location.X), WorldToCell(Location.Y));
+			SlotCellKeys[PawnIndex] = CellKey;
+			Cells.FindOrAdd(CellKey).Add(PawnIndex);
+		}
+		else
+		{
+			UpdateSlotCell(PawnIndex);
+		}
+	}
+}
+
+/**
+ * Broadphase over the cells covered by the sweep's bounds, then an exact
+ * segment-vs-capsule-axis distance test per candidate.
+ */
+void UNeonCombatPawnRegistry::QuerySweptSphere(const FVector& Start, const FVector& End, float Radius, TArray<FNeonPawnSweepHit>& OutHits) const
+{
+	OutHits.Reset();
+
+	if (Pawns.Num() == FreeSlots.Num() - FreeSlotsHead)
+	{
+		return;
+	}
+
+	// ========================================
+	// Broadphase - cells under the swept bounds
+	// ========================================
+	const float Reach = Radius + MaxCapsuleRadius;
+	const int32 MinCellX = WorldToCell(FMath::Min(Start.X, End.X) - Reach);
+	const int32 MaxCellX = WorldToCell(FMath::Max(Start.X, End.X) + Reach);
+	const int32 MinCellY = WorldToCell(FMath::Min(Start.Y, End.Y) - Reach);
+	const int32 MaxCellY = WorldToCell(FMath::Max(Start.Y, End.Y) + Reach);
+
+	const float SweepLengthSq = FVector::DistSquared(Start, End);
+
+	for (int32 CellX = MinCellX; CellX <= MaxCellX; ++CellX)
+	{
+		for (int32 CellY = MinCellY; CellY <= MaxCellY; ++CellY)
+		{
+			const TArray<int32>* CellSlots = Cells.Find(MakeCellKey(CellX, CellY));
+			if (!CellSlots)
+			{
+				continue;
+			}
+
+			// ========================================
+			// Narrowphase - swept sphere vs capsule
+			// ========================================
+			for (const int32 PawnIndex : *CellSlots)
+			{
+				// Capsule = segment along Z (inner half height) inflated by the capsule radius
+				const float InnerHalfHeight = FMath::Max(CapsuleHalfHeight[PawnIndex] - CapsuleRadius[PawnIndex], 0.f);
+				const FVector Center(CenterX[PawnIndex], CenterY[PawnIndex], CenterZ[PawnIndex]);
+				const FVector AxisBottom = Center - FVector(0.f, 0.f, InnerHalfHeight);
+				const FVector AxisTop = Center + FVector(0.f, 0.f, InnerHalfHeight);
+
+				FVector ClosestOnSweep;
+				FVector ClosestOnAxis;
+				FMath::SegmentDistToSegmentSafe(Start, End, AxisBottom, AxisTop, ClosestOnSweep, ClosestOnAxis);
+
+				const float ContactDistance = Radius + CapsuleRadius[PawnIndex];
+				if (FVector::DistSquared(ClosestOnSweep, ClosestOnAxis) > FMath::Square(ContactDistance))
+				{
+					continue;
+				}
+
+				FNeonPawnSweepHit& Hit = OutHits.AddDefaulted_GetRef();
+				Hit.PawnIndex = PawnIndex;
+				Hit.Time = SweepLengthSq > UE_SMALL_NUMBER
+					? FMath::Sqrt(FVector::DistSquared(Start, ClosestOnSweep) / SweepLengthSq)
+					: 0.f;
+			}
+		}
+	}
+
+	// Process in the order the sweep reaches the pawns (ties broken by slot for determinism)
+	OutHits.Sort([](const FNeonPawnSweepHit& A, const FNeonPawnSweepHit& B)
+	{
+		return A.Time != B.Time ? A.Time < B.Time : A.PawnIndex < B.PawnIndex;
+	});
+}
+
+// ========================================
+// Slot Access
+// ========================================
+
+APlayerCharacter* UNeonCombatPawnRegistry::GetPawn(int32 PawnIndex) const
+{
+	return Pawns.IsValidIndex(PawnIndex) ? Pawns[PawnIndex] : nullptr;
+}
+
+UAbilitySystemComponent* UNeonCombatPawnRegistry::GetAbilitySystemComponent(int32 PawnIndex) const
+{
+	return AbilitySystems.IsValidIndex(PawnIndex) ? AbilitySystems[PawnIndex] : nullptr;
+}
+
+bool UNeonCombatPawnRegistry::GetCapsule(int32 PawnIndex, FVector& OutCenter, float& OutRadius, float& OutHalfHeight) const
+{
+	if (!Pawns.IsValidIndex(PawnIndex) || !Pawns[PawnIndex])
+	{
+		return false;
+	}
+
+	OutCenter = FVector(CenterX[PawnIndex], CenterY[PawnIndex], CenterZ[PawnIndex]);
+	OutRadius = CapsuleRadius[PawnIndex];
+	OutHalfHeight = CapsuleHalfHeight[PawnIndex];
+	return true;
+}
+
+// ========================================
+// Helpers
+// ========================================
+
+int64 UNeonCombatPawnRegistry::MakeCellKey(int32 CellX, int32 CellY)
+{
+	return (static_cast<int64>(CellX) << 32) | static_cast<uint32>(CellY);
+}
+
+int32 UNeonCombatPawnRegistry::WorldToCell(float Value) const
+{
+	return FMath::FloorToInt32(Value / CellSize);
+}
+
+/**
+ * Refiles a slot if its center moved into a different cell.
+ */
+void UNeonCombatPawnRegistry::UpdateSlotCell(int32 PawnIndex)
+{
+	const int64 NewCellKey = MakeCellKey(WorldToCell(CenterX[PawnIndex]), WorldToCell(CenterY[PawnIndex]));
+	if (NewCellKey == SlotCellKeys[PawnIndex])
+	{
+		return;
+	}
+
+	RemoveSlotFromCell(PawnIndex);
+	SlotCellKeys[PawnIndex] = NewCellKey;
+	Cells.FindOrAdd(NewCellKey).Add(PawnIndex);
+}
+
+/**
+ * Removes a slot from its cell, dropping the cell once it's empty.
+ */
+void UNeonCombatPawnRegistry::RemoveSlotFromCell(int32 PawnIndex)
+{
+	const int64 CellKey = SlotCellKeys[PawnIndex];
+	if (TArray<int32>* CellSlots = Cells.Find(CellKey))
+	{
+		CellSlots->RemoveSingleSwap(PawnIndex, EAllowShrinking::No);
+		if (CellSlots->Num() == 0)
+		{
+			Cells.Remove(CellKey);
+		}
+	}
+}
+
+// ========================================
+// Subsystem
+// ========================================
+
+/**
+ * Forgets every pawn when the world goes away.
+ */
+void UNeonCombatPawnRegistry::Deinitialize()
+{
+	for (APlayerCharacter* Pawn : Pawns)
+	{
+		if (Pawn)
+		{
+			Pawn->CombatRegistryIndex = INDEX_NONE;
+		}
+	}
+
+	Pawns.Reset();
+	AbilitySystems.Reset();
+	CenterX.Reset();
+	CenterY.Reset();
+	CenterZ.Reset();
+	CapsuleRadius.Reset();
+	CapsuleHalfHeight.Reset();
+	SlotCellKeys.Reset();
+	SlotGenerations.Reset();
+	FreeSlots.Reset();
+	FreeSlotReleaseTimes.Reset();
+	FreeSlotsHead = 0;
+	Cells.Reset();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds have combat pawns.
+ */
+bool UNeonCombatPawnRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonCombatPawnRegistry.generated.h"
+
+// Forward declarations
+class APlayerCharacter;
+class UAbilitySystemComponent;
+
+/**
+ * One pawn found by a swept-sphere query.
+ */
+struct FNeonPawnSweepHit
+{
+	/** Registry slot of the pawn */
+	int32 PawnIndex = INDEX_NONE;
+
+	/** How far along the sweep (0 = start, 1 = end) the pawn is closest to the swept path */
+	float Time = 0.f;
+};
+
+/**
+ * Registry of every combat pawn (APlayerCharacter and subclasses) in the world.
+ *
+ * Gives each pawn a stable slot index for as long as it is alive and keeps its capsule in a
+ * uniform 2D grid (spatial hash). The grid is updated incrementally: a pawn only moves between
+ * cell lists when it crosses a cell boundary.
+ *
+ * Used by projectiles as a broadphase for hit detection instead of physics overlap events,
+ * and as the index space for their per-phase hit bitsets. Every slot has a generation that is bumped
+ * when its pawn unregisters, so a projectile still in flight never mistakes a newly spawned pawn in a
+ * reused slot for one it already hit. Freed slots also wait neon.Combat.RegistrySlotReuseDelay seconds
+ * before reuse, which keeps those generation checks rare.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonCombatPawnRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// Registration
+	// ========================================
+
+	/**
+	 * Adds a pawn to the registry and the spatial hash.
+	 *
+	 * @return Stable slot index for the pawn (also stored on the pawn)
+	 */
+	int32 RegisterPawn(APlayerCharacter* Pawn);
+
+	/** Removes a pawn from the registry and the spatial hash */
+	void UnregisterPawn(APlayerCharacter* Pawn);
+
+	// ========================================
+	// Spatial Hash
+	// ========================================
+
+	/**
+	 * Re-reads pawn locations and capsule sizes and moves pawns between cells where needed.
+	 * Cheap to call several times per frame - only the first call in a frame does any work.
+	 */
+	void RefreshSpatialHash();
+
+	/**
+	 * Finds every registered pawn whose capsule touches a sphere swept from Start to End.
+	 * Results are sorted by Time, so hits are processed in the order the sphere reaches them.
+	 *
+	 * @param Start - Sweep start
+	 * @param End - Sweep end
+	 * @param Radius - Radius of the swept sphere
+	 * @param OutHits - Receives the hits (reset first)
+	 */
+	void QuerySweptSphere(const FVector& Start, const FVector& End, float Radius, TArray<FNeonPawnSweepHit>& OutHits) const;
+
+	// ========================================
+	// Slot Access
+	// ========================================
+
+	/** Pawn stored in a slot (nullptr for free slots) */
+	APlayerCharacter* GetPawn(int32 PawnIndex) const;
+
+	/** Ability System Component of the pawn in a slot */
+	UAbilitySystemComponent* GetAbilitySystemComponent(int32 PawnIndex) const;
+
+	/**
+	 * Capsule of the pawn in a slot as of the last RefreshSpatialHash.
+	 *
+	 * @return False for free or invalid slots
+	 */
+	bool GetCapsule(int32 PawnIndex, FVector& OutCenter, float& OutRadius, float& OutHalfHeight) const;
+
+	/** Number of slots (including free ones) - upper bound for slot indices */
+	int32 GetNumSlots() const { return Pawns.Num(); }
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds have combat pawns */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Packs 2D cell coordinates into a single hash key */
+	static int64 MakeCellKey(int32 CellX, int32 CellY);
+
+	/** Cell coordinate containing a world position */
+	int32 WorldToCell(float Value) const;
+
+	/** Moves a slot to the cell containing its current center */
+	void UpdateSlotCell(int32 PawnIndex);
+
+	/** Removes a slot from its current cell list */
+	void RemoveSlotFromCell(int32 PawnIndex);
+
+	/** Pawn per slot (nullptr = free slot) */
+	UPROPERTY()
+	TArray<APlayerCharacter*> Pawns;
+
+	/** Cached Ability System Component per slot */
+	UPROPERTY()
+	TArray<UAbilitySystemComponent*> AbilitySystems;
+
+	/** Capsule center per slot */
+	TArray<float> CenterX, CenterY, CenterZ;
+
+	/** Scaled capsule radius per slot */
+	TArray<float> CapsuleRadius;
+
+	/** Scaled capsule half height per slot */
+	TArray<float> CapsuleHalfHeight;
+
+	/** Cell the slot is currently filed under */
+	TArray<int64> SlotCellKeys;
+
+	/** Bumped every time a slot is freed */
+	TArray<uint32> SlotGenerations;
+
+	/** Slots not currently used by a pawn, oldest release first (queue: entries before FreeSlotsHead are consumed) */
+	TArray<int32> FreeSlots;
+
+	/** World time each entry in FreeSlots was released */
+	TArray<double> FreeSlotReleaseTimes;
+
+	/** First queued entry of FreeSlots/FreeSlotReleaseTimes */
+	int32 FreeSlotsHead = 0;
+
+	/** Cell key -> slots whose capsule center lies in that cell */
+	TMap<int64, TArray<int32>> Cells;
+
+	/** Current grid cell size (mirrors neon.Combat.SpatialHashCellSize) */
+	float CellSize = 500.f;
+
+	/** Largest capsule radius seen (queries expand by this so capsules straddling a cell border are found) */
+	float MaxCapsuleRadius = 0.f;
+
+	/** Frame of the last RefreshSpatialHash */
+	uint64 LastRefreshFrame = 0;
+};
\ No newline at end of file
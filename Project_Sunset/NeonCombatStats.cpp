@@ -0,0 +1,36 @@
+#include "NeonCombatStats.h"
+
+DEFINE_STAT(STAT_NeonProjectileSimTick);
+DEFINE_STAT(STAT_NeonProjectileStep);
+DEFINE_STAT(STAT_NeonProjectileHashHits);
+DEFINE_STAT(STAT_NeonProjectileWriteBack);
+DEFINE_STAT(STAT_NeonProjectileCollision);
+DEFINE_STAT(STAT_NeonProjectileApplyEffect);
+DEFINE_STAT(STAT_NeonPawnHashRefresh);
+DEFINE_STAT(STAT_NeonDamageExec);
+DEFINE_STAT(STAT_NeonDamagePipeline);
+DEFINE_STAT(STAT_NeonAttributePostExecute);
+DEFINE_STAT(STAT_NeonTelegraphStart);
+DEFINE_STAT(STAT_NeonTelegraphStop);
+DEFINE_STAT(STAT_NeonTelegraphUpdate);
+DEFINE_STAT(STAT_NeonAoeResolve);
+DEFINE_STAT(STAT_NeonSignificanceUpdate);
+DEFINE_STAT(STAT_NeonAttributeEventFlush);
+DEFINE_STAT(STAT_NeonServerReplicateActors);
+
+DEFINE_STAT(STAT_NeonLiveProjectiles);
+DEFINE_STAT(STAT_NeonEnemiesHigh);
+DEFINE_STAT(STAT_NeonEnemiesMedium);
+DEFINE_STAT(STAT_NeonEnemiesLow);
+DEFINE_STAT(STAT_NeonEffectsApplied);
+DEFINE_STAT(STAT_NeonDamageExecutions);
+DEFINE_STAT(STAT_NeonCombosTriggered);
+
+UE_TRACE_CHANNEL_DEFINE(NeonCombatChannel);
+
+#if !UE_BUILD_SHIPPING
+uint64 FNeonCombatCounters::EffectsApplied = 0;
+uint64 FNeonCombatCounters::DamageExecutions = 0;
+uint64 FNeonCombatCounters::CombosTriggered = 0;
+uint64 FNeonCombatCounters::ServerReplicateCycles = 0;
+#endif
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Profiling hooks for combat code.
+ *
+ * - "stat NeonCombat" shows the cycle stats and counters below
+ * - Unreal Insights shows NEON_COMBAT_SCOPE regions as CPU events; they are only recorded while
+ *   the NeonCombat trace channel is on (-trace=cpu,NeonCombat, or Trace.Enable NeonCombat)
+ */
+DECLARE_STATS_GROUP(TEXT("NeonCombat"), STATGROUP_NeonCombat, STATCAT_Advanced);
+
+// ========================================
+// Cycle Stats
+// ========================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Sim Tick"), STAT_NeonProjectileSimTick, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Step"), STAT_NeonProjectileStep, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Spatial Hash Hits"), STAT_NeonProjectileHashHits, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Write Back"), STAT_NeonProjectileWriteBack, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Collision Logic"), STAT_NeonProjectileCollision, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Apply Effect"), STAT_NeonProjectileApplyEffect, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pawn Spatial Hash Refresh"), STAT_NeonPawnHashRefresh, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Exec"), STAT_NeonDamageExec, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Pipeline"), STAT_NeonDamagePipeline, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Attribute PostEffectExecute"), STAT_NeonAttributePostExecute, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Telegraph Start"), STAT_NeonTelegraphStart, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Telegraph Stop"), STAT_NeonTelegraphStop, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Telegraph Update"), STAT_NeonTelegraphUpdate, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AOE Resolve"), STAT_NeonAoeResolve, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance Update"), STAT_NeonSignificanceUpdate, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Attribute Event Flush"), STAT_NeonAttributeEventFlush, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Server Replicate Actors"), STAT_NeonServerReplicateActors, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+
+// ========================================
+// Counters
+// ========================================
+
+/** Projectiles currently simulated (set once per frame) */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Projectiles"), STAT_NeonLiveProjectiles, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+
+/** Enemies per significance bucket (set by each scoring pass) */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemies High"), STAT_NeonEnemiesHigh, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemies Medium"), STAT_NeonEnemiesMedium, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemies Low"), STAT_NeonEnemiesLow, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+
+/** Gameplay effects applied by projectiles this frame */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effects Applied"), STAT_NeonEffectsApplied, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+
+/** Damage executions this frame */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Executions"), STAT_NeonDamageExecutions, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+
+/** Combo rules that fired this frame */
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Combos Triggered"), STAT_NeonCombosTriggered, STATGROUP_NeonCombat, PROJECT_SUNSET_API);
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Running totals of the counters above (stat counters reset every frame and can't be read back).
+ * Read by Neon.Bench.CombatStress. Game thread only.
+ */
+struct PROJECT_SUNSET_API FNeonCombatCounters
+{
+	static uint64 EffectsApplied;
+	static uint64 DamageExecutions;
+	static uint64 CombosTriggered;
+
+	/** Cycles spent in UNeonReplicationGraph::ServerReplicateActors */
+	static uint64 ServerReplicateCycles;
+};
+
+/** Bumps a per-frame counter stat and its running total */
+#define NEON_COMBAT_INC(Counter, Amount) \
+	do \
+	{ \
+		INC_DWORD_STAT_BY(STAT_Neon##Counter, Amount); \
+		FNeonCombatCounters::Counter += (Amount); \
+	} \
+	while (0)
+
+#else
+
+#define NEON_COMBAT_INC(Counter, Amount) \
+	do \
+	{ \
+		INC_DWORD_STAT_BY(STAT_Neon##Counter, Amount); \
+	} \
+	while (0)
+
+#endif // !UE_BUILD_SHIPPING
+
+// ========================================
+// Insights
+// ========================================
+
+UE_TRACE_CHANNEL_EXTERN(NeonCombatChannel, PROJECT_SUNSET_API);
+
+/** Cycle stat + Insights CPU event (on the NeonCombat channel) for the enclosing scope */
+#define NEON_COMBAT_SCOPE(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, NeonCombatChannel)
\ No newline at end of file
@@ -0,0 +1,796 @@
+#include "NeonCombatStressBenchmark.h"
+#include "NeonDamageExecCalculation.h"
+#include "NeonProjectile.h"
+#include "NeonProjectilePoolSubsystem.h"
+#include "NeonProjectileSimSubsystem.h"
+#include "NeonCombatStats.h"
+#include "NeonCombatLog.h"
+#include "EnemyCharacter.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/MemoryBase.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+
+// ========================================
+// Native Stress Effects
+// ========================================
+
+/**
+ * Instant effect running the damage exec.
+ */
+UNeonStressDamageEffect::UNeonStressDamageEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FGameplayEffectExecutionDefinition DamageExecution;
+	DamageExecution.CalculationClass = UNeonDamageExecCalculation::StaticClass();
+	Executions.Add(DamageExecution);
+}
+
+/**
+ * Two second duration effect with no modifiers.
+ */
+UNeonStressCorruptionEffect::UNeonStressCorruptionEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::HasDuration;
+	DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(2.f));
+}
+
+/**
+ * Headless combat stress benchmark.
+ *
+ * Spawns N enemies and keeps N pooled boomerangs in flight between them on a fixed 60 Hz timestep,
+ * for N = 10, 100 and 1000. Each scenario warms up, then measures a fixed number of frames and
+ * reports frame time percentiles, effect applications and damage executions per second, combos
+ * and allocations per frame. Results go to the log and to CSV + JSON files for tracking across builds.
+ *
+ * Runs as an automation test (one case per entity count) in any game world, including -nullrhi:
+ *   UnrealEditor-Cmd Project_Sunset.uproject /Game/Maps/Empty -game -nullrhi -unattended
+ *     -ExecCmds="Automation RunTests Neon.Combat.StressBenchmark; Quit"
+ *
+ * The console command runs all three scenarios in one go (and takes the options below):
+ *   UnrealEditor-Cmd Project_Sunset.uproject /Game/Maps/Empty -game -nullrhi -unattended
+ *     -ExecCmds="Neon.Bench.CombatStress Frames=600 Quit"
+ *
+ * Server net cost: run the map as a listen/dedicated server with Clients=N, then connect N headless clients.
+ * Scenarios start once N clients are connected, and each row adds the server's replication time per frame:
+ *   UnrealEditor-Cmd Project_Sunset.uproject /Game/Maps/Empty -server -nullrhi -unattended
+ *     -ExecCmds="Neon.Bench.CombatStress Clients=8 Quit"
+ *   UnrealEditor-Cmd Project_Sunset.uproject 127.0.0.1 -game -nullrhi -unattended    (x8)
+ *
+ * Not compiled into shipping builds.
+ */
+#if !UE_BUILD_SHIPPING
+
+namespace NeonCombatStress
+{
+	/** Entity counts run by the console command, one automation test case each (enemies and boomerangs each) */
+	static const int32 DefaultEntityCounts[] = { 10, 100, 1000 };
+
+	/** Simulation step forced for the duration of the run */
+	static constexpr double FixedDeltaTime = 1.0 / 60.0;
+
+	/** Frames run before measuring (pool growth, first hits, effect bookkeeping settling) */
+	static constexpr int32 WarmupFrames = 60;
+
+	/** Distance between enemies in the spawn grid */
+	static constexpr float EnemySpacing = 300.f;
+
+	/** Outgoing distance of every boomerang */
+	static constexpr float BoomerangDistance = 1500.f;
+
+	/** Data.Damage passed to the damage effect */
+	static constexpr float BoomerangDamage = 5.f;
+
+	/** Command line settings */
+	struct FSettings
+	{
+		/** Scenarios to run, in order */
+		TArray<int32> EntityCounts = TArray<int32>(DefaultEntityCounts, UE_ARRAY_COUNT(DefaultEntityCounts));
+
+		/** Frames measured per scenario */
+		int32 MeasureFrames = 600;
+
+		/** Effect applied by returning boomerangs */
+		TSubclassOf<UGameplayEffect> DamageEffect;
+
+		/** Effect applied by outgoing boomerangs */
+		TSubclassOf<UGameplayEffect> CorruptionEffect;
+
+		/** Connected clients to wait for before the first scenario */
+		int32 WaitForClients = 0;
+
+		/** Use spatial hash hit detection instead of physics overlaps */
+		bool bSpatialHashHits = false;
+
+		/** Exit the process once all scenarios are written */
+		bool bQuitWhenDone = false;
+
+		/** Directory for the CSV/JSON results */
+		FString OutputDir;
+	};
+
+	/** Measurements of one scenario */
+	struct FScenarioResult
+	{
+		int32 Entities = 0;
+		int32 Frames = 0;
+		double MeanMs = 0.0;
+		double P50Ms = 0.0;
+		double P90Ms = 0.0;
+		double P99Ms = 0.0;
+		double MaxMs = 0.0;
+		double EffectsPerSecond = 0.0;
+		double DamageExecsPerSecond = 0.0;
+		uint64 Combos = 0;
+
+		/** Client connections during the scenario */
+		int32 Connections = 0;
+
+		/** Server replication time per frame; negative without a replication graph or clients */
+		double NetReplicateMs = -1.0;
+
+		/** Negative when the allocator doesn't count calls in this build */
+		double AllocsPerFrame = -1.0;
+	};
+
+	/**
+	 * Malloc calls so far, or -1 if the allocator doesn't track them.
+	 */
+	static int64 GetTotalMallocCalls()
+	{
+#if STATS
+		return static_cast<int64>(FMalloc::TotalMallocCalls);
+#else
+		return -1;
+#endif
+	}
+
+	/**
+	 * Client connections on the world's game net driver (0 when standalone).
+	 */
+	static int32 GetNumClientConnections(const UWorld* World)
+	{
+		const UNetDriver* NetDriver = World->GetNetDriver();
+		return NetDriver ? NetDriver->ClientConnections.Num() : 0;
+	}
+
+	/**
+	 * Nearest-rank percentile of a sorted array.
+	 */
+	static double Percentile(const TArray<double>& Sorted, double Fraction)
+	{
+		if (Sorted.Num() == 0)
+		{
+			return 0.0;
+		}
+
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt32(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Rank];
+	}
+
+	/**
+	 * Drives the scenarios from the core ticker, one engine frame per tick.
+	 */
+	class FRunner
+	{
+	public:
+		FRunner(UWorld* InWorld, const FSettings& InSettings)
+			: World(InWorld)
+			, Settings(InSettings)
+		{
+			// Deterministic simulation: every frame advances exactly one fixed step
+			bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+			PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+			FApp::SetUseFixedTimeStep(true);
+			FApp::SetFixedDeltaTime(FixedDeltaTime);
+
+			if (Settings.bSpatialHashHits)
+			{
+				SetForceSpatialHashHits(true);
+			}
+
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRunner::Tick));
+		}
+
+		~FRunner()
+		{
+			if (!bFinished)
+			{
+				FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+				Finish();
+			}
+		}
+
+		/** Runs once every scenario is written (or the run was aborted), from inside the runner's last tick */
+		TFunction<void()> OnFinished;
+
+		/** True once the run is over (results are final) */
+		bool IsFinished() const { return bFinished; }
+
+		/** One row per completed scenario */
+		const TArray<FScenarioResult>& GetResults() const { return Results; }
+
+	private:
+		/** Scenario phases */
+		enum class EPhase : uint8
+		{
+			Setup,
+			Warmup,
+			Measure
+		};
+
+		/**
+		 * Advances the current scenario by one frame.
+		 *
+		 * @return False once every scenario is done (removes the ticker)
+		 */
+		bool Tick(float DeltaTime)
+		{
+			const double Now = FPlatformTime::Seconds();
+			const double FrameSeconds = LastTickTime > 0.0 ? Now - LastTickTime : 0.0;
+			LastTickTime = Now;
+
+			if (!World.IsValid())
+			{
+				NEON_COMBAT_LOG(Error, TEXT("CombatStress: world went away, aborting"));
+				Finish();
+				return false;
+			}
+
+			switch (Phase)
+			{
+			case EPhase::Setup:
+				if (GetNumClientConnections(World.Get()) < Settings.WaitForClients)
+				{
+					// Checked every frame; clients connect in the background
+					break;
+				}
+				SetupScenario();
+				Phase = EPhase::Warmup;
+				PhaseFrame = 0;
+				break;
+
+			case EPhase::Warmup:
+				TopUpProjectiles();
+				if (++PhaseFrame >= WarmupFrames)
+				{
+					BeginMeasure();
+					Phase = EPhase::Measure;
+					PhaseFrame = 0;
+				}
+				break;
+
+			case EPhase::Measure:
+				FrameTimes.Add(FrameSeconds);
+				TopUpProjectiles();
+				if (++PhaseFrame >= Settings.MeasureFrames)
+				{
+					EndMeasure();
+					TeardownScenario();
+
+					if (++ScenarioIndex >= Settings.EntityCounts.Num())
+					{
+						WriteResults();
+						Finish();
+						return false;
+					}
+
+					Phase = EPhase::Setup;
+				}
+				break;
+			}
+
+			return true;
+		}
+
+		// ========================================
+		// Scenario
+		// ========================================
+
+		/**
+		 * Spawns the enemy grid and prewarms the projectile pool.
+		 */
+		void SetupScenario()
+		{
+			UWorld* TheWorld = World.Get();
+			const int32 NumEntities = Settings.EntityCounts[ScenarioIndex];
+			const int32 GridSide = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumEntities)));
+
+			// Same layout and shots every run
+			Random.Initialize(1234 + NumEntities);
+
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			for (int32 Index = 0; Index < NumEntities; ++Index)
+			{
+				const FVector Location((Index % GridSide) * EnemySpacing, (Index / GridSide) * EnemySpacing, 200.f);
+				AEnemyCharacter* Enemy = TheWorld->SpawnActor<AEnemyCharacter>(AEnemyCharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+				if (!Enemy)
+				{
+					continue;
+				}
+
+				// Empty test maps have no floor - keep everyone in place
+				if (UCharacterMovementComponent* Movement = Enemy->GetCharacterMovement())
+				{
+					Movement->DisableMovement();
+				}
+
+				Enemies.Add(Enemy);
+			}
+
+			if (UNeonProjectilePoolSubsystem* Pool = TheWorld->GetSubsystem<UNeonProjectilePoolSubsystem>())
+			{
+				Pool->PrewarmPool(ANeonProjectile::StaticClass(), NumEntities);
+			}
+		}
+
+		/**
+		 * Fires boomerangs from random enemies until NumEntities are in flight.
+		 */
+		void TopUpProjectiles()
+		{
+			UWorld* TheWorld = World.Get();
+			UNeonProjectilePoolSubsystem* Pool = TheWorld->GetSubsystem<UNeonProjectilePoolSubsystem>();
+			UNeonProjectileSimSubsystem* Sim = TheWorld->GetSubsystem<UNeonProjectileSimSubsystem>();
+			if (!Pool || !Sim || Enemies.Num() == 0)
+			{
+				return;
+			}
+
+			const int32 NumEntities = Settings.EntityCounts[ScenarioIndex];
+			for (int32 Live = Sim->GetNumSimulatedProjectiles(); Live < NumEntities; ++Live)
+			{
+				AEnemyCharacter* Caster = Enemies[Random.RandHelper(Enemies.Num())].Get();
+				if (!Caster)
+				{
+					continue;
+				}
+
+				const FRotator Aim(0.f, Random.FRandRange(0.f, 360.f), 0.f);
+				const FTransform LaunchTransform(Aim, Caster->GetActorLocation() + Aim.Vector() * 100.f);
+
+				ANeonProjectile* Projectile = Pool->AcquireProjectile(ANeonProjectile::StaticClass(), LaunchTransform, Caster, Caster);
+				if (!Projectile)
+				{
+					return;
+				}
+
+				Projectile->DamageEffectClass = TSoftClassPtr<UGameplayEffect>(Settings.DamageEffect.Get());
+				Projectile->CorruptionEffectClass = TSoftClassPtr<UGameplayEffect>(Settings.CorruptionEffect.Get());
+				Projectile->DamageMagnitude = BoomerangDamage;
+				Projectile->InitializeBoomerang(Caster, BoomerangDistance);
+
+				Fired.Add(Projectile);
+			}
+		}
+
+		/**
+		 * Snapshots the running counters at the start of the measured window.
+		 */
+		void BeginMeasure()
+		{
+			FrameTimes.Reset(Settings.MeasureFrames);
+			StartEffects = FNeonCombatCounters::EffectsApplied;
+			StartExecs = FNeonCombatCounters::DamageExecutions;
+			StartCombos = FNeonCombatCounters::CombosTriggered;
+			StartReplicateCycles = FNeonCombatCounters::ServerReplicateCycles;
+			StartMallocs = GetTotalMallocCalls();
+			MeasureStartTime = FPlatformTime::Seconds();
+		}
+
+		/**
+		 * Turns the measured window into a result row.
+		 */
+		void EndMeasure()
+		{
+			const double MeasureSeconds = FMath::Max(FPlatformTime::Seconds() - MeasureStartTime, UE_DOUBLE_SMALL_NUMBER);
+			const int64 EndMallocs = GetTotalMallocCalls();
+
+			TArray<double> Sorted = FrameTimes;
+			Sorted.Sort();
+
+			double TotalSeconds = 0.0;
+			for (const double Seconds : Sorted)
+			{
+				TotalSeconds += Seconds;
+			}
+
+			FScenarioResult& Result = Results.AddDefaulted_GetRef();
+			Result.Entities = Settings.EntityCounts[ScenarioIndex];
+			Result.Frames = Sorted.Num();
+			Result.MeanMs = Sorted.Num() > 0 ? TotalSeconds * 1000.0 / Sorted.Num() : 0.0;
+			Result.P50Ms = Percentile(Sorted, 0.50) * 1000.0;
+			Result.P90Ms = Percentile(Sorted, 0.90) * 1000.0;
+			Result.P99Ms = Percentile(Sorted, 0.99) * 1000.0;
+			Result.MaxMs = Sorted.Num() > 0 ? Sorted.Last() * 1000.0 : 0.0;
+			Result.EffectsPerSecond = (FNeonCombatCounters::EffectsApplied - StartEffects) / MeasureSeconds;
+			Result.DamageExecsPerSecond = (FNeonCombatCounters::DamageExecutions - StartExecs) / MeasureSeconds;
+			Result.Combos = FNeonCombatCounters::CombosTriggered - StartCombos;
+			Result.Connections = GetNumClientConnections(World.Get());
+
+			const uint64 ReplicateCycles = FNeonCombatCounters::ServerReplicateCycles - StartReplicateCycles;
+			if (ReplicateCycles > 0 && Result.Frames > 0)
+			{
+				Result.NetReplicateMs = FPlatformTime::ToMilliseconds64(ReplicateCycles) / Result.Frames;
+			}
+
+			if (StartMallocs >= 0 && EndMallocs >= 0 && Result.Frames > 0)
+			{
+				Result.AllocsPerFrame = static_cast<double>(EndMallocs - StartMallocs) / Result.Frames;
+			}
+
+			UE_LOG(LogNeonBench, Display,
+				TEXT("CombatStress N=%4d | frame mean %6.2f ms p50 %6.2f p90 %6.2f p99 %6.2f max %6.2f | effects %9.0f/s | damage execs %9.0f/s | combos %llu | allocs/frame %.1f | clients %d net %.3f ms"),
+				Result.Entities, Result.MeanMs, Result.P50Ms, Result.P90Ms, Result.P99Ms, Result.MaxMs,
+				Result.EffectsPerSecond, Result.DamageExecsPerSecond, Result.Combos, Result.AllocsPerFrame,
+				Result.Connections, Result.NetReplicateMs);
+		}
+
+		/**
+		 * Returns every projectile to the pool and destroys the enemies.
+		 */
+		void TeardownScenario()
+		{
+			if (UNeonProjectilePoolSubsystem* Pool = World.IsValid() ? World->GetSubsystem<UNeonProjectilePoolSubsystem>() : nullptr)
+			{
+				for (const TWeakObjectPtr<ANeonProjectile>& Projectile : Fired)
+				{
+					// Double release is ignored by the pool
+					Pool->ReleaseProjectile(Projectile.Get());
+				}
+			}
+			Fired.Reset();
+
+			for (const TWeakObjectPtr<AEnemyCharacter>& Enemy : Enemies)
+			{
+				if (Enemy.IsValid())
+				{
+					Enemy->Destroy();
+				}
+			}
+			Enemies.Reset();
+		}
+
+		// ========================================
+		// Output
+		// ========================================
+
+		/**
+		 * Writes all scenario rows as CSV and JSON.
+		 */
+		void WriteResults() const
+		{
+			const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+			const FString BasePath = FPaths::Combine(Settings.OutputDir, FString::Printf(TEXT("NeonCombatStress_%s"), *Stamp));
+
+			FString Csv = TEXT("entities,frames,mean_ms,p50_ms,p90_ms,p99_ms,max_ms,effects_per_sec,damage_execs_per_sec,combos,allocs_per_frame,clients,net_replicate_ms\n");
+			FString Json = TEXT("{\n");
+			Json += FString::Printf(TEXT("  \"build\": \"%s\",\n"), LexToString(FApp::GetBuildConfiguration()));
+			Json += FString::Printf(TEXT("  \"engine\": \"%s\",\n"), *FEngineVersion::Current().ToString());
+			Json += FString::Printf(TEXT("  \"spatial_hash_hits\": %s,\n"), Settings.bSpatialHashHits ? TEXT("true") : TEXT("false"));
+			Json += TEXT("  \"scenarios\": [\n");
+
+			for (int32 Index = 0; Index < Results.Num(); ++Index)
+			{
+				const FScenarioResult& Result = Results[Index];
+
+				Csv += FString::Printf(TEXT("%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.1f,%.1f,%llu,%.2f,%d,%.4f\n"),
+					Result.Entities, Result.Frames, Result.MeanMs, Result.P50Ms, Result.P90Ms, Result.P99Ms, Result.MaxMs,
+					Result.EffectsPerSecond, Result.DamageExecsPerSecond, Result.Combos, Result.AllocsPerFrame,
+					Result.Connections, Result.NetReplicateMs);
+
+				Json += FString::Printf(
+					TEXT("    { \"entities\": %d, \"frames\": %d, \"mean_ms\": %.4f, \"p50_ms\": %.4f, \"p90_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f, ")
+					TEXT("\"effects_per_sec\": %.1f, \"damage_execs_per_sec\": %.1f, \"combos\": %llu, \"allocs_per_frame\": %.2f, ")
+					TEXT("\"clients\": %d, \"net_replicate_ms\": %.4f }%s\n"),
+					Result.Entities, Result.Frames, Result.MeanMs, Result.P50Ms, Result.P90Ms, Result.P99Ms, Result.MaxMs,
+					Result.EffectsPerSecond, Result.DamageExecsPerSecond, Result.Combos, Result.AllocsPerFrame,
+					Result.Connections, Result.NetReplicateMs,
+					Index + 1 < Results.Num() ? TEXT(",") : TEXT(""));
+			}
+
+			Json += TEXT("  ]\n}\n");
+
+			const bool bWroteCsv = FFileHelper::SaveStringToFile(Csv, *(BasePath + TEXT(".csv")));
+			const bool bWroteJson = FFileHelper::SaveStringToFile(Json, *(BasePath + TEXT(".json")));
+
+			if (bWroteCsv && bWroteJson)
+			{
+				UE_LOG(LogNeonBench, Display, TEXT("CombatStress: results written to %s.csv/.json"), *BasePath);
+			}
+			else
+			{
+				NEON_COMBAT_LOG(Error, TEXT("CombatStress: failed to write results to %s"), *BasePath);
+			}
+		}
+
+		/**
+		 * Restores engine settings and optionally exits.
+		 */
+		void Finish()
+		{
+			bFinished = true;
+
+			FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+			FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+
+			if (Settings.bSpatialHashHits)
+			{
+				SetForceSpatialHashHits(false);
+			}
+
+			if (Settings.bQuitWhenDone)
+			{
+				FPlatformMisc::RequestExit(false, TEXT("Neon.Bench.CombatStress"));
+			}
+
+			if (OnFinished)
+			{
+				OnFinished();
+			}
+		}
+
+		/**
+		 * Toggles neon.Projectile.ForceSpatialHashHits.
+		 */
+		static void SetForceSpatialHashHits(bool bEnabled)
+		{
+			if (IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("neon.Projectile.ForceSpatialHashHits")))
+			{
+				CVar->Set(bEnabled, ECVF_SetByCode);
+			}
+		}
+
+		TWeakObjectPtr<UWorld> World;
+		FSettings Settings;
+		FTSTicker::FDelegateHandle TickerHandle;
+
+		EPhase Phase = EPhase::Setup;
+		int32 ScenarioIndex = 0;
+		int32 PhaseFrame = 0;
+		bool bFinished = false;
+
+		FRandomStream Random;
+		TArray<TWeakObjectPtr<AEnemyCharacter>> Enemies;
+		TArray<TWeakObjectPtr<ANeonProjectile>> Fired;
+
+		double LastTickTime = 0.0;
+		double MeasureStartTime = 0.0;
+		TArray<double> FrameTimes;
+		uint64 StartEffects = 0;
+		uint64 StartExecs = 0;
+		uint64 StartCombos = 0;
+		uint64 StartReplicateCycles = 0;
+		int64 StartMallocs = -1;
+		TArray<FScenarioResult> Results;
+
+		bool bPrevUseFixedTimeStep = false;
+		double PrevFixedDeltaTime = FixedDeltaTime;
+	};
+
+	/** Console command run in progress (replaced if the command is issued again, released when it finishes) */
+	static TUniquePtr<FRunner> ActiveRunner;
+
+	/**
+	 * Releases a finished console run. Deferred by a frame: runners finish from inside their own tick.
+	 */
+	static void ReleaseActiveRunner(const FRunner* FinishedRunner)
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([FinishedRunner](float)
+		{
+			// A new run may have replaced it in the meantime
+			if (ActiveRunner.Get() == FinishedRunner)
+			{
+				ActiveRunner.Reset();
+			}
+			return false;
+		}));
+	}
+
+	/**
+	 * Settings shared by the console command and the automation test: native effects, Saved/Benchmarks output.
+	 */
+	static FSettings MakeDefaultSettings()
+	{
+		FSettings Settings;
+		Settings.DamageEffect = UNeonStressDamageEffect::StaticClass();
+		Settings.CorruptionEffect = UNeonStressCorruptionEffect::StaticClass();
+		Settings.OutputDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"));
+		return Settings;
+	}
+
+	/**
+	 * Neon.Bench.CombatStress [Frames=N] [Clients=N] [Hits=Hash] [DamageEffect=ClassPath] [CorruptionEffect=ClassPath] [Out=Dir] [Quit]
+	 */
+	static FAutoConsoleCommandWithWorldAndArgs CombatStressCommand(
+		TEXT("Neon.Bench.CombatStress"),
+		TEXT("Runs the combat stress scenarios (10/100/1000 enemies + boomerangs, fixed 60 Hz) and writes CSV/JSON to Saved/Benchmarks. ")
+		TEXT("Args: Frames=N (measured frames, default 600), Clients=N (wait for N connected clients), Hits=Hash (spatial hash hit detection), DamageEffect=/CorruptionEffect= (effect class paths), Out=Dir, Quit (exit when done)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World || !World->IsGameWorld())
+			{
+				NEON_COMBAT_LOG(Error, TEXT("CombatStress: needs a game world (run with -game or in PIE)"));
+				return;
+			}
+
+			FSettings Settings = MakeDefaultSettings();
+
+			for (const FString& Arg : Args)
+			{
+				FString Key;
+				FString Value;
+				if (!Arg.Split(TEXT("="), &Key, &Value))
+				{
+					Key = Arg;
+				}
+
+				if (Key == TEXT("Frames"))
+				{
+					Settings.MeasureFrames = FMath::Max(1, FCString::Atoi(*Value));
+				}
+				else if (Key == TEXT("Clients"))
+				{
+					Settings.WaitForClients = FMath::Max(0, FCString::Atoi(*Value));
+				}
+				else if (Key == TEXT("Hits"))
+				{
+					Settings.bSpatialHashHits = Value == TEXT("Hash");
+				}
+				else if (Key == TEXT("DamageEffect") || Key == TEXT("CorruptionEffect"))
+				{
+					UClass* EffectClass = LoadClass<UGameplayEffect>(nullptr, *Value);
+					if (!EffectClass)
+					{
+						NEON_COMBAT_LOG(Error, TEXT("CombatStress: could not load effect class %s"), *Value);
+						return;
+					}
+					(Key == TEXT("DamageEffect") ? Settings.DamageEffect : Settings.CorruptionEffect) = EffectClass;
+				}
+				else if (Key == TEXT("Out"))
+				{
+					Settings.OutputDir = Value;
+				}
+				else if (Key == TEXT("Quit"))
+				{
+					Settings.bQuitWhenDone = true;
+				}
+			}
+
+			ActiveRunner = MakeUnique<FRunner>(World, Settings);
+			ActiveRunner->OnFinished = [FinishedRunner = ActiveRunner.Get()]() { ReleaseActiveRunner(FinishedRunner); };
+		})
+	);
+
+	// ========================================
+	// Automation Test
+	// ========================================
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+	/**
+	 * First game or PIE world (the test needs a running game, e.g. -game -nullrhi).
+	 */
+	static UWorld* FindGameWorld()
+	{
+		if (!GEngine)
+		{
+			return nullptr;
+		}
+
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+			{
+				return Context.World();
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Owns one runner and waits for it; the runner itself advances from the core ticker every engine frame.
+	 */
+	class FRunScenarioCommand : public IAutomationLatentCommand
+	{
+	public:
+		FRunScenarioCommand(FAutomationTestBase* InTest, UWorld* InWorld, const FSettings& InSettings)
+			: Test(InTest)
+			, World(InWorld)
+			, Settings(InSettings)
+		{
+		}
+
+		virtual bool Update() override
+		{
+			if (!Runner)
+			{
+				Runner = MakeUnique<FRunner>(World.Get(), Settings);
+				return false;
+			}
+
+			if (!Runner->IsFinished())
+			{
+				return false;
+			}
+
+			const TArray<FScenarioResult>& Results = Runner->GetResults();
+			if (Results.Num() != 1)
+			{
+				Test->AddError(TEXT("Scenario did not complete (world went away?)"));
+				return true;
+			}
+
+			const FScenarioResult& Result = Results[0];
+			Test->AddInfo(FString::Printf(TEXT("N=%d: frame mean %.2f ms, p99 %.2f ms, effects %.0f/s, damage execs %.0f/s, allocs/frame %.1f"),
+				Result.Entities, Result.MeanMs, Result.P99Ms, Result.EffectsPerSecond, Result.DamageExecsPerSecond, Result.AllocsPerFrame));
+
+			Test->TestEqual(TEXT("Measured frames"), Result.Frames, Settings.MeasureFrames);
+			Test->TestTrue(TEXT("Boomerangs applied effects"), Result.EffectsPerSecond > 0.0);
+			Test->TestTrue(TEXT("Damage exec ran"), Result.DamageExecsPerSecond > 0.0);
+			return true;
+		}
+
+	private:
+		FAutomationTestBase* Test;
+		TWeakObjectPtr<UWorld> World;
+		FSettings Settings;
+		TUniquePtr<FRunner> Runner;
+	};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FNeonCombatStressBenchmarkTest, "Neon.Combat.StressBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+/**
+ * One case per entity count.
+ */
+void FNeonCombatStressBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumEntities : NeonCombatStress::DefaultEntityCounts)
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Entities"), NumEntities));
+		OutTestCommands.Add(LexToString(NumEntities));
+	}
+}
+
+/**
+ * Queues the scenario; results are checked by the latent command once it has run.
+ */
+bool FNeonCombatStressBenchmarkTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = NeonCombatStress::FindGameWorld();
+	if (!World)
+	{
+		AddError(TEXT("Needs a game world - run with -game (e.g. -game -nullrhi) or in PIE"));
+		return false;
+	}
+
+	NeonCombatStress::FSettings Settings = NeonCombatStress::MakeDefaultSettings();
+	Settings.EntityCounts = { FCString::Atoi(*Parameters) };
+
+	ADD_LATENT_AUTOMATION_COMMAND(NeonCombatStress::FRunScenarioCommand(this, World, Settings));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+#endif // !UE_BUILD_SHIPPING
\ No newline at end of file
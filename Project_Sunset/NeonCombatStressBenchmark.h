@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "NeonCombatStressBenchmark.generated.h"
+
+/**
+ * Native effects used by Neon.Bench.CombatStress when no effect assets are passed in,
+ * so the benchmark runs in an empty map with no content.
+ */
+
+/**
+ * Instant damage through UNeonDamageExecCalculation (damage comes from the projectile's Data.Damage).
+ */
+UCLASS(NotBlueprintable, HideDropdown)
+class PROJECT_SUNSET_API UNeonStressDamageEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UNeonStressDamageEffect();
+};
+
+/**
+ * Short duration effect standing in for the corruption debuff (exercises active effect bookkeeping).
+ */
+UCLASS(NotBlueprintable, HideDropdown)
+class PROJECT_SUNSET_API UNeonStressCorruptionEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UNeonStressCorruptionEffect();
+};
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include "NeonComboTable.h"
+#include "NeonDamageExecCalculation.h"
+#include "GameplayEffect.h"
+#include "GameplayTagsManager.h"
+
+// ========================================
+// FNeonComboLookup
+// ========================================
+
+/**
+ * Expands each rule to its status tag's children, buckets the result by net index
+ * and packs the buckets into one array.
+ */
+void FNeonComboLookup::Build(const TArray<FNeonComboRule>& InRules)
+{
+	UGameplayTagsManager& TagManager = UGameplayTagsManager::Get();
+
+	Rules = InRules;
+	BucketStart.Reset();
+	Entries.Reset();
+
+	// Collect (net index, entry) pairs for every tag that triggers a rule
+	TArray<TPair<FGameplayTagNetIndex, FEntry>> Pending;
+	FGameplayTagNetIndex MaxNetIndex = 0;
+
+	for (int32 RuleIndex = 0; RuleIndex < Rules.Num(); ++RuleIndex)
+	{
+		const FNeonComboRule& Rule = Rules[RuleIndex];
+		if (!Rule.TargetStatusTag.IsValid() || !Rule.DamageTypeTag.IsValid())
+		{
+			continue;
+		}
+
+		FEntry Entry;
+		Entry.RuleIndex = RuleIndex;
+		Entry.DamageTypeTag = Rule.DamageTypeTag;
+		Entry.Multiplier = Rule.Multiplier;
+		Entry.FlatBonus = Rule.FlatBonus;
+
+		FGameplayTagContainer TriggerTags = TagManager.RequestGameplayTagChildren(Rule.TargetStatusTag);
+		TriggerTags.AddTag(Rule.TargetStatusTag);
+
+		for (const FGameplayTag& TriggerTag : TriggerTags)
+		{
+			const FGameplayTagNetIndex NetIndex = TagManager.GetNetIndexFromTag(TriggerTag);
+			if (NetIndex == INVALID_TAGNETINDEX)
+			{
+				continue;
+			}
+
+			Pending.Emplace(NetIndex, Entry);
+			MaxNetIndex = FMath::Max(MaxNetIndex, NetIndex);
+		}
+	}
+
+	// Counting sort into buckets
+	if (Pending.Num() > 0)
+	{
+		BucketStart.SetNumZeroed(MaxNetIndex + 2);
+
+		for (const TPair<FGameplayTagNetIndex, FEntry>& Item : Pending)
+		{
+			++BucketStart[Item.Key + 1];
+		}
+		for (int32 Bucket = 1; Bucket < BucketStart.Num(); ++Bucket)
+		{
+			BucketStart[Bucket] += BucketStart[Bucket - 1];
+		}
+
+		TArray<int32> WriteOffsets(BucketStart.GetData(), BucketStart.Num() - 1);
+		Entries.SetNum(Pending.Num());
+		for (const TPair<FGameplayTagNetIndex, FEntry>& Item : Pending)
+		{
+			Entries[WriteOffsets[Item.Key]++] = Item.Value;
+		}
+	}
+
+	NetIndexHash = TagManager.GetNetworkGameplayTagNodeIndexHash();
+	bIsBuilt = true;
+}
+
+/**
+ * Net indices are only stable while the tag tree is unchanged.
+ */
+bool FNeonComboLookup::IsUpToDate() const
+{
+	return bIsBuilt && NetIndexHash == UGameplayTagsManager::Get().GetNetworkGameplayTagNodeIndexHash();
+}
+
+/**
+ * One pass over the target's tags; each candidate rule costs one asset tag check.
+ */
+FNeonComboResult FNeonComboLookup::Resolve(const FGameplayTagContainer& TargetTags, const FGameplayEffectSpec& Spec) const
+{
+	FNeonComboResult Result;
+
+	if (Entries.Num() == 0)
+	{
+		return Result;
+	}
+
+	UGameplayTagsManager& TagManager = UGameplayTagsManager::Get();
+	const int32 NumBuckets = BucketStart.Num() - 1;
+
+	// A target with both Status.Corrupted and Status.Corrupted.Heavy must still fire the Status.Corrupted rule once
+	TBitArray<TInlineAllocator<4>> FiredRules(false, Rules.Num());
+
+	for (const FGameplayTag& TargetTag : TargetTags)
+	{
+		const int32 NetIndex = TagManager.GetNetIndexFromTag(TargetTag);
+		if (NetIndex >= NumBuckets)
+		{
+			// Also covers INVALID_TAGNETINDEX
+			continue;
+		}
+
+		for (int32 EntryIndex = BucketStart[NetIndex]; EntryIndex < BucketStart[NetIndex + 1]; ++EntryIndex)
+		{
+			const FEntry& Entry = Entries[EntryIndex];
+			if (FiredRules[Entry.RuleIndex] || !UNeonDamageExecCalculation::SpecHasAssetTag(Spec, Entry.DamageTypeTag))
+			{
+				continue;
+			}
+
+			FiredRules[Entry.RuleIndex] = true;
+			Result.Multiplier *= Entry.Multiplier;
+			Result.FlatBonus += Entry.FlatBonus;
+			++Result.NumCombos;
+		}
+	}
+
+	return Result;
+}
+
+// ========================================
+// UNeonComboTable
+// ========================================
+
+/**
+ * Rebakes lazily if the tag tree changed since the last bake.
+ */
+FNeonComboResult UNeonComboTable::ResolveCombos(const FGameplayTagContainer& TargetTags, const FGameplayEffectSpec& Spec) const
+{
+	return GetLookup().Resolve(TargetTags, Spec);
+}
+
+/**
+ * Resolving through the returned lookup is const, so worker threads can share it.
+ */
+const FNeonComboLookup& UNeonComboTable::GetLookup() const
+{
+	if (!Lookup.IsUpToDate())
+	{
+		Lookup.Build(Rules);
+	}
+
+	return Lookup;
+}
+
+/**
+ * Bakes the rules as soon as the asset is loaded, so the first hit doesn't pay for it.
+ */
+void UNeonComboTable::PostLoad()
+{
+	Super::PostLoad();
+
+	Lookup.Build(Rules);
+}
+
+#if WITH_EDITOR
+/**
+ * Rebakes after rules are edited.
+ */
+void UNeonComboTable::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	Lookup.Build(Rules);
+}
+#endif
\ No newline at end of file
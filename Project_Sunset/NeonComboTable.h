@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "NeonComboTable.generated.h"
+
+// Forward declarations
+struct FGameplayEffectSpec;
+
+/**
+ * One combo: damage of a given type against a target with a given status.
+ * Both tags match hierarchically (a rule on Status.Corrupted also fires for Status.Corrupted.Heavy).
+ */
+USTRUCT(BlueprintType)
+struct FNeonComboRule
+{
+	GENERATED_BODY()
+
+	/** Status the target must have (owned gameplay tag) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	FGameplayTag TargetStatusTag;
+
+	/** Damage type the effect must carry (asset tag on the spec or effect) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	FGameplayTag DamageTypeTag;
+
+	/** Multiplier applied to base damage when the combo fires */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo", Meta = (ClampMin = "0.0"))
+	float Multiplier = 1.f;
+
+	/** Added after all multipliers */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	float FlatBonus = 0.f;
+};
+
+/**
+ * Combined effect of every combo that fired for one hit.
+ */
+struct FNeonComboResult
+{
+	/** Product of the multipliers of all fired combos */
+	float Multiplier = 1.f;
+
+	/** Sum of the flat bonuses of all fired combos */
+	float FlatBonus = 0.f;
+
+	/** Number of combos that fired */
+	int32 NumCombos = 0;
+
+	/** Final damage: base scaled by the multiplier, then the flat bonus added */
+	float Apply(float BaseDamage) const { return BaseDamage * Multiplier + FlatBonus; }
+};
+
+/**
+ * Combo rules baked into a flat lookup keyed by the net index of the status tag.
+ *
+ * Each rule's status tag and all of its child tags get a bucket listing the rules they trigger,
+ * stored back to back in one array (bucket N spans BucketStart[N] to BucketStart[N + 1]).
+ * Resolving a hit walks the target's explicit owned tags once and only looks at the rules in
+ * their buckets, so the cost depends on how many tags the target has, not on the number of rules.
+ *
+ * Net indices change when tags are added at runtime (editor, plugin mounts), so the lookup
+ * remembers the tag manager's net index hash and rebuilds when it no longer matches.
+ */
+struct PROJECT_SUNSET_API FNeonComboLookup
+{
+	/** Rebuilds the lookup from a rule list */
+	void Build(const TArray<FNeonComboRule>& InRules);
+
+	/** True once built and while tag net indices are unchanged since the build */
+	bool IsUpToDate() const;
+
+	/**
+	 * Finds every combo that fires for a hit.
+	 *
+	 * @param TargetTags - Target's explicit owned tags (parents are handled by the bake)
+	 * @param Spec - Damage spec; its asset tags are checked for each candidate rule's damage type
+	 * @return Combined multiplier/bonus of the fired combos
+	 */
+	FNeonComboResult Resolve(const FGameplayTagContainer& TargetTags, const FGameplayEffectSpec& Spec) const;
+
+private:
+	/** Baked rule, duplicated into the bucket of every tag that triggers it */
+	struct FEntry
+	{
+		/** Index into the source rules - used to fire each rule at most once per hit */
+		int32 RuleIndex = INDEX_NONE;
+
+		FGameplayTag DamageTypeTag;
+		float Multiplier = 1.f;
+		float FlatBonus = 0.f;
+	};
+
+	/** Bucket offsets into Entries, one per net index plus an end marker */
+	TArray<int32> BucketStart;
+
+	/** All buckets, back to back */
+	TArray<FEntry> Entries;
+
+	/** Rules the lookup was built from (kept for rebuilds) */
+	TArray<FNeonComboRule> Rules;
+
+	/** UGameplayTagsManager::GetNetworkGameplayTagNodeIndexHash() at build time */
+	uint32 NetIndexHash = 0;
+
+	/** False until Build has run */
+	bool bIsBuilt = false;
+};
+
+/**
+ * Designer-edited table of damage combos (status tag x damage type tag -> multiplier and flat bonus).
+ * Used by UNeonDamageExecCalculation; new combos are data, not code.
+ */
+UCLASS(BlueprintType)
+class PROJECT_SUNSET_API UNeonComboTable : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Combo rules; several rules may fire on the same hit and stack */
+	UPROPERTY(EditDefaultsOnly, Category = "Combos")
+	TArray<FNeonComboRule> Rules;
+
+	/**
+	 * Resolves every combo that fires for a hit (rebakes first if tag net indices changed).
+	 *
+	 * @param TargetTags - Target's explicit owned tags
+	 * @param Spec - Damage spec
+	 */
+	FNeonComboResult ResolveCombos(const FGameplayTagContainer& TargetTags, const FGameplayEffectSpec& Spec) const;
+
+	/** Baked lookup, rebaked first if tag net indices changed (game thread; the result is safe to read anywhere) */
+	const FNeonComboLookup& GetLookup() const;
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** Baked form of Rules (mutable: rebuilt lazily from const lookups) */
+	mutable FNeonComboLookup Lookup;
+};
\ No newline at end of file
@@ -1,24 +1,35 @@
 #include "NeonDamageExecCalculation.h"
 #include "NeonAttributeSet.h"
 #include "AbilitySystemComponent.h"
+#include "NeonGameplayTags.h"
+#include "NeonComboTable.h"
+#include "NeonCombatLog.h"
+#include "NeonCombatStats.h"
+#include "NeonCombatEventSubsystem.h"
+#include "NeonAssetPreloadSubsystem.h"
 
 /**
  * Static struct that defines which attributes this calculation captures.
- * We capture Health because we're going to reduce it (deal damage).
+ * Only stats that scale the damage are captured - Health is written through an output modifier
+ * and never read, so capturing it would only cost an aggregator per hit.
  */
 struct NeonDamageStatics
 {
-	// Macro that declares we want to capture the Health attribute
-	DECLARE_ATTRIBUTE_CAPTUREDEF(Health);
+	DECLARE_ATTRIBUTE_CAPTUREDEF(AttackPower);
+	DECLARE_ATTRIBUTE_CAPTUREDEF(NeonPotency);
+	DECLARE_ATTRIBUTE_CAPTUREDEF(Defense);
+	DECLARE_ATTRIBUTE_CAPTUREDEF(NeonResistance);
 
 	NeonDamageStatics()
 	{
-		// Define how we capture Health:
-		// - From UNeonAttributeSet
-		// - The Health attribute specifically
-		// - From the Target (not the Source/attacker)
-		// - false = don't snapshot (use current value)
-		DEFINE_ATTRIBUTE_CAPTUREDEF(UNeonAttributeSet, Health, Target, false);
+		// Attacker stats are snapshotted when the spec is made: a boomerang keeps the stats it was thrown with,
+		// and a spec shared by a batch of targets captures them once
+		DEFINE_ATTRIBUTE_CAPTUREDEF(UNeonAttributeSet, AttackPower, Source, true);
+		DEFINE_ATTRIBUTE_CAPTUREDEF(UNeonAttributeSet, NeonPotency, Source, true);
+
+		// Defender stats must be the ones at the moment of the hit (no snapshot)
+		DEFINE_ATTRIBUTE_CAPTUREDEF(UNeonAttributeSet, Defense, Target, false);
+		DEFINE_ATTRIBUTE_CAPTUREDEF(UNeonAttributeSet, NeonResistance, Target, false);
 	}
 };
 
@@ -37,106 +48,274 @@ static const NeonDamageStatics& DamageStatics()
  */
 UNeonDamageExecCalculation::UNeonDamageExecCalculation()
 {
-	// Tell the system we need access to the target's Health attribute
-	RelevantAttributesToCapture.Add(DamageStatics().HealthDef);
+	RelevantAttributesToCapture.Add(DamageStatics().AttackPowerDef);
+	RelevantAttributesToCapture.Add(DamageStatics().NeonPotencyDef);
+	RelevantAttributesToCapture.Add(DamageStatics().DefenseDef);
+	RelevantAttributesToCapture.Add(DamageStatics().NeonResistanceDef);
+}
+
+/**
+ * Evaluates one capture of a spec. Leaves OutMagnitude at its default when the capture is missing,
+ * e.g. specs built without a source ASC or targets without a UNeonAttributeSet.
+ */
+static void CalculateCapturedMagnitude(const FGameplayEffectSpec& Spec, const FGameplayEffectAttributeCaptureDefinition& Definition, float& OutMagnitude)
+{
+	const FGameplayEffectAttributeCaptureSpec* CaptureSpec = Spec.CapturedRelevantAttributes.FindCaptureSpecByDefinition(Definition, true);
+	if (!CaptureSpec)
+	{
+		return;
+	}
+
+	FAggregatorEvaluateParameters EvaluateParams;
+	EvaluateParams.SourceTags = Spec.CapturedSourceTags.GetAggregatedTags();
+	EvaluateParams.TargetTags = Spec.CapturedTargetTags.GetAggregatedTags();
+
+	CaptureSpec->AttemptCalculateAttributeMagnitude(EvaluateParams, OutMagnitude);
+}
+
+/**
+ * Built-in combo rules used when no ComboTable is configured.
+ * Neon damage against a corrupted target deals 2.5x damage.
+ */
+static const FNeonComboLookup& GetDefaultComboLookup()
+{
+	static FNeonComboLookup DefaultLookup;
+
+	// Also rebuilds if tag net indices changed since the last build
+	if (!DefaultLookup.IsUpToDate())
+	{
+		FNeonComboRule NeonVsCorrupted;
+		NeonVsCorrupted.TargetStatusTag = NeonGameplayTags::Status_Corrupted;
+		NeonVsCorrupted.DamageTypeTag = NeonGameplayTags::Damage_Type_Neon;
+		NeonVsCorrupted.Multiplier = 2.5f;
+
+		DefaultLookup.Build({ NeonVsCorrupted });
+	}
+
+	return DefaultLookup;
 }
 
 /**
  * Executes the damage calculation with combo multiplier logic.
  * 
  * Combo System:
- * 1. Check if target has "Status.Corrupted" tag
- * 2. Check if damage has "Damage.Type.Neon" tag
- * 3. If both true: multiply damage by 2.5x
+ * 1. Read base damage from the Data.Damage SetByCaller (scaled by Data.Falloff for AOE hits and the attacker's stats)
+ * 2. Resolve every combo rule matching the target's status tags and the damage's type tags
+ * 3. Scale by the combined multiplier, add the combined flat bonus, then reduce by the target's defenses
  * 4. Apply final damage to target's Health
  */
 void UNeonDamageExecCalculation::Execute_Implementation(
 	const FGameplayEffectCustomExecutionParameters& ExecutionParams,
 	FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
+	NEON_COMBAT_SCOPE(STAT_NeonDamageExec);
+	NEON_COMBAT_INC(DamageExecutions, 1);
+
 	// Get the target's Ability System Component (needed to check tags)
 	UAbilitySystemComponent* TargetASC = ExecutionParams.GetTargetAbilitySystemComponent();
 	
 	// Get the Gameplay Effect spec (contains tags and damage values)
 	const FGameplayEffectSpec& Spec = ExecutionParams.GetOwningSpec();
-	FGameplayTagContainer AssetTags;
-	Spec.GetAllAssetTags(AssetTags);
 
 	// ========================================
-	// Step 1: Get Gameplay Tags
+	// Step 1-3: Base Damage, Combos, Multiplier
 	// ========================================
-	
-	// Tag indicating target is corrupted (debuff status)
-	FGameplayTag StatusCorrupted = FGameplayTag::RequestGameplayTag(FName("Status.Corrupted"));
-	
-	// Tag indicating this damage is Neon-type
-	FGameplayTag DamageNeon = FGameplayTag::RequestGameplayTag(FName("Damage.Type.Neon"));
-	
-	// Tag used to pass damage value from Blueprint
-	FGameplayTag DataDamage = FGameplayTag::RequestGameplayTag(FName("Data.Damage"));
 
-	// ========================================
-	// Step 2: Check Combo Conditions
-	// ========================================
-	
-	// Does target have the Corrupted status effect?
-	bool bIsTargetCorrupted = false;
-	if (TargetASC)
+	// Mass hits arrive with the final damage already resolved (FNeonDamagePipeline) - stats and combos included
+	float BaseDamage = Spec.GetSetByCallerMagnitude(NeonGameplayTags::Data_ResolvedDamage, false, -1.0f);
+	if (BaseDamage < 0.f)
 	{
-		bIsTargetCorrupted = TargetASC->HasMatchingGameplayTag(StatusCorrupted);
+		// AOE falloff (only set by area damage, everything else takes full damage)
+		const float Scale = Spec.GetSetByCallerMagnitude(NeonGameplayTags::Data_Falloff, false, 1.0f);
+
+		FNeonDamageAttributes Attributes;
+		CaptureSourceAttributes(Spec, Attributes);
+		CaptureTargetAttributes(Spec, Attributes);
+
+		// Target has no ASC -> no status tags -> no combos
+		FNeonComboResult Combo;
+		BaseDamage = CalculateDamage(Spec, Scale, Attributes, TargetASC ? &TargetASC->GetOwnedGameplayTags() : nullptr, GetComboLookup(TargetASC), Combo);
+
+		if (Combo.NumCombos > 0)
+		{
+			NEON_COMBAT_INC(CombosTriggered, Combo.NumCombos);
+			NEON_COMBAT_VERBOSE(TEXT(">>> COMBO TRIGGERED! %d combo(s) = %.2fx Damage + %.1f <<<"), 
+				Combo.NumCombos, Combo.Multiplier, Combo.FlatBonus);
+
+			const UAbilitySystemComponent* SourceASC = ExecutionParams.GetSourceAbilitySystemComponent();
+			RecordComboEvent(SourceASC ? SourceASC->GetAvatarActor() : nullptr, TargetASC->GetAvatarActor(), BaseDamage, Combo);
+		}
+		else
+		{
+			NEON_COMBAT_VERBOSE(TEXT("No Combo."));
+		}
 	}
-	
-	// Is this Neon-type damage?
-	bool bIsNeonDamage = AssetTags.HasTag(DamageNeon);
 
 	// ========================================
-	// Step 3: Get Base Damage Value
+	// Step 4: Apply Final Damage
 	// ========================================
 	
+	if (BaseDamage > 0.f)
+	{
+		// Add a modifier that subtracts health (negative = damage)
+		// This goes through PostGameplayEffectExecute where it triggers damage delegate
+		OutExecutionOutput.AddOutputModifier(
+			FGameplayModifierEvaluatedData(
+				UNeonAttributeSet::GetHealthAttribute(), 
+				EGameplayModOp::Additive, 
+				-BaseDamage // Negative to reduce health
+			)
+		);
+	}
+}
+
+/**
+ * Steps 1-3 of the exec without touching the target: everything comes from the spec, the hit's scale and stats,
+ * the target's tags and a prepared lookup, so FNeonDamagePipeline can run it on worker threads.
+ */
+float UNeonDamageExecCalculation::CalculateDamage(const FGameplayEffectSpec& Spec, float Scale, const FNeonDamageAttributes& Attributes,
+	const FGameplayTagContainer* TargetTags, const FNeonComboLookup& Combos, FNeonComboResult& OutCombo)
+{
 	// Retrieve damage value sent by Blueprint using SetByCaller
 	// Parameters: (Tag to check, bWarnIfNotFound, DefaultValue)
-	float BaseDamage = Spec.GetSetByCallerMagnitude(DataDamage, false, -1.0f);
+	float BaseDamage = Spec.GetSetByCallerMagnitude(NeonGameplayTags::Data_Damage, false, -1.0f);
 
 	// Fallback if Blueprint didn't provide damage value
 	if (BaseDamage == -1.0f)
 	{
 		BaseDamage = 10.0f; // Safe default value
-		UE_LOG(LogTemp, Error, 
+		NEON_COMBAT_LOG(Warning, 
 			TEXT("NeonDamageExec: No Damage Value Found! Defaulting to 10. Check your Gameplay Ability."));
 	}
 
-	// ========================================
-	// Step 4: Apply Combo Multiplier
-	// ========================================
-	
-	if (bIsTargetCorrupted && bIsNeonDamage)
+	const bool bNeonDamage = SpecHasAssetTag(Spec, NeonGameplayTags::Damage_Type_Neon);
+
+	// Attacker stats (aggregated values aren't clamped like the attribute itself, so clamp here)
+	BaseDamage *= Scale * FMath::Max(Attributes.AttackPower, 0.f);
+	if (bNeonDamage)
 	{
-		// COMBO TRIGGERED! Neon damage against corrupted target = 2.5x damage
-		UE_LOG(LogTemp, Warning, TEXT(">>> COMBO TRIGGERED! Neon vs Corrupted = 2.5x Damage <<<"));
-		BaseDamage *= 2.5f;
+		BaseDamage *= FMath::Max(Attributes.NeonPotency, 0.f);
 	}
-	else
+
+	// Explicit tags only; the lookup already expanded its rules to child tags
+	OutCombo = TargetTags ? Combos.Resolve(*TargetTags, Spec) : FNeonComboResult();
+	float Damage = OutCombo.NumCombos > 0 ? OutCombo.Apply(BaseDamage) : BaseDamage;
+
+	// Defender stats last, so they also reduce combo bonuses
+	Damage *= 100.f / (100.f + FMath::Max(Attributes.Defense, 0.f));
+	if (bNeonDamage)
 	{
-		// No combo - log why for debugging
-		UE_LOG(LogTemp, Display, TEXT("No Combo. Corrupted: %s | Neon: %s"), 
-			bIsTargetCorrupted ? TEXT("YES") : TEXT("NO"), 
-			bIsNeonDamage ? TEXT("YES") : TEXT("NO"));
+		Damage *= 1.f - FMath::Clamp(Attributes.NeonResistance, 0.f, 1.f);
 	}
 
-	// ========================================
-	// Step 5: Apply Final Damage
-	// ========================================
-	
-	if (BaseDamage > 0.f)
+	return Damage;
+}
+
+/**
+ * Neon potency is only evaluated for Neon-type damage - it can't change anything else.
+ */
+void UNeonDamageExecCalculation::CaptureSourceAttributes(const FGameplayEffectSpec& Spec, FNeonDamageAttributes& OutAttributes)
+{
+	CalculateCapturedMagnitude(Spec, DamageStatics().AttackPowerDef, OutAttributes.AttackPower);
+
+	if (SpecHasAssetTag(Spec, NeonGameplayTags::Damage_Type_Neon))
 	{
-		// Add a modifier that subtracts health (negative = damage)
-		// This goes through PostGameplayEffectExecute where it triggers damage delegate
-		OutExecutionOutput.AddOutputModifier(
-			FGameplayModifierEvaluatedData(
-				DamageStatics().HealthProperty, 
-				EGameplayModOp::Additive, 
-				-BaseDamage // Negative to reduce health
-			)
-		);
+		CalculateCapturedMagnitude(Spec, DamageStatics().NeonPotencyDef, OutAttributes.NeonPotency);
+	}
+}
+
+/**
+ * Only valid on the spec GAS applies to the target (the exec's owning spec) - outgoing specs have no target captures.
+ */
+void UNeonDamageExecCalculation::CaptureTargetAttributes(const FGameplayEffectSpec& Spec, FNeonDamageAttributes& OutAttributes)
+{
+	CalculateCapturedMagnitude(Spec, DamageStatics().DefenseDef, OutAttributes.Defense);
+
+	if (SpecHasAssetTag(Spec, NeonGameplayTags::Damage_Type_Neon))
+	{
+		CalculateCapturedMagnitude(Spec, DamageStatics().NeonResistanceDef, OutAttributes.NeonResistance);
+	}
+}
+
+/**
+ * Same stats as CaptureTargetAttributes, read straight from the target's current values.
+ * Targets without a UNeonAttributeSet keep the neutral defaults.
+ */
+void UNeonDamageExecCalculation::ReadTargetAttributes(const UAbilitySystemComponent& TargetASC, const FGameplayEffectSpec& Spec, FNeonDamageAttributes& OutAttributes)
+{
+	bool bFound = false;
+	const float Defense = TargetASC.GetGameplayAttributeValue(UNeonAttributeSet::GetDefenseAttribute(), bFound);
+	if (bFound)
+	{
+		OutAttributes.Defense = Defense;
+	}
+
+	if (SpecHasAssetTag(Spec, NeonGameplayTags::Damage_Type_Neon))
+	{
+		const float NeonResistance = TargetASC.GetGameplayAttributeValue(UNeonAttributeSet::GetNeonResistanceAttribute(), bFound);
+		if (bFound)
+		{
+			OutAttributes.NeonResistance = NeonResistance;
+		}
+	}
+}
+
+/**
+ * Game thread only: may rebake a lookup whose tag net indices went stale.
+ */
+const FNeonComboLookup& UNeonDamageExecCalculation::GetComboLookup(const UObject* WorldContext) const
+{
+	const UNeonComboTable* Table = GetComboTable(WorldContext);
+	return Table ? Table->GetLookup() : GetDefaultComboLookup();
+}
+
+/**
+ * Combos go to the world's combat event ring (no-op outside game worlds).
+ */
+void UNeonDamageExecCalculation::RecordComboEvent(AActor* Source, AActor* Target, float Damage, const FNeonComboResult& Combo)
+{
+	UWorld* World = Target ? Target->GetWorld() : nullptr;
+	if (UNeonCombatEventSubsystem* CombatEvents = World ? World->GetSubsystem<UNeonCombatEventSubsystem>() : nullptr)
+	{
+		CombatEvents->RecordEvent(ENeonCombatEventType::Combo, Source, Target, Damage, FGameplayTag(),
+			static_cast<uint8>(FMath::Min(Combo.NumCombos, 255)));
+	}
+}
+
+/**
+ * Tests both asset tag sources in place. Spec.GetAllAssetTags() would append them
+ * into a fresh container (an allocation plus parent tag expansion) on every execution.
+ */
+bool UNeonDamageExecCalculation::SpecHasAssetTag(const FGameplayEffectSpec& Spec, const FGameplayTag& Tag)
+{
+	if (Spec.GetDynamicAssetTags().HasTag(Tag))
+	{
+		return true;
+	}
+
+	return Spec.Def && Spec.Def->GetAssetTags().HasTag(Tag);
+}
+
+/**
+ * Non-blocking: the preload subsystem keeps the table resident once streamed, so this is a weak pointer check.
+ */
+const UNeonComboTable* UNeonDamageExecCalculation::GetComboTable(const UObject* WorldContext) const
+{
+	if (ComboTable.IsNull())
+	{
+		return nullptr;
+	}
+
+	return UNeonAssetPreloadSubsystem::ResolveObject(WorldContext, ComboTable);
+}
+
+/**
+ * Read from the CDO by characters building their preload set.
+ */
+void UNeonDamageExecCalculation::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	if (!ComboTable.IsNull())
+	{
+		OutAssets.Add(ComboTable.ToSoftObjectPath());
 	}
 }
\ No newline at end of file
@@ -2,20 +2,56 @@
 
 #include "CoreMinimal.h"
 #include "GameplayEffectExecutionCalculation.h"
+#include "NeonComboTable.h"
 #include "NeonDamageExecCalculation.generated.h"
 
+// Forward declarations
+class UAbilitySystemComponent;
+
+/**
+ * Attacker and defender stats that scale one hit. The defaults are neutral (base damage in and out).
+ */
+struct FNeonDamageAttributes
+{
+	/** Attacker's outgoing damage multiplier */
+	float AttackPower = 1.f;
+
+	/** Attacker's multiplier for Neon-type damage */
+	float NeonPotency = 1.f;
+
+	/** Defender's damage reduction: damage * 100 / (100 + Defense) */
+	float Defense = 0.f;
+
+	/** Fraction of Neon-type damage the defender ignores */
+	float NeonResistance = 0.f;
+};
+
 /**
  * Custom damage calculation that applies systemic multipliers based on gameplay tags.
- * Specifically handles the "Neon + Corruption = Bonus Damage" combo mechanic.
+ * Combos (target status tag x damage type tag) come from a UNeonComboTable data asset.
  * 
  * How it works:
- * - If target has "Status.Corrupted" tag AND damage has "Damage.Type.Neon" tag
- * - Then damage is multiplied by 2.5x
+ * - Every rule whose status tag the target has AND whose damage type tag the effect has fires
+ * - Fired multipliers stack multiplicatively, flat bonuses are added afterwards
+ * - The attacker's AttackPower/NeonPotency scale the damage before combos (snapshotted with the spec),
+ *   the target's Defense/NeonResistance reduce it after them (current values)
+ * - Without a configured table, the built-in rule applies:
+ *   "Status.Corrupted" target + "Damage.Type.Neon" damage = 2.5x damage
  * 
  * This allows for strategic gameplay where players corrupt enemies first,
  * then follow up with Neon attacks for massive damage.
+ *
+ * Batches applied through UNeonEffectLibrary resolve their damage ahead of time (FNeonDamagePipeline)
+ * and pass it as Data.ResolvedDamage; the exec then only applies it.
+ * 
+ * The table is streamed with each character's combat assets (GetPreloadAssets) and baked once it lands;
+ * hits before that use the built-in rule instead of loading it synchronously.
+ *
+ * Table is set in DefaultGame.ini:
+ * [/Script/Project_Sunset.NeonDamageExecCalculation]
+ * ComboTable=/Game/Path/To/DA_ComboTable.DA_ComboTable
  */
-UCLASS()
+UCLASS(Config = Game)
 class PROJECT_SUNSET_API UNeonDamageExecCalculation : public UGameplayEffectExecutionCalculation
 {
 	GENERATED_BODY()
@@ -34,4 +70,62 @@ public:
 		const FGameplayEffectCustomExecutionParameters& ExecutionParams, 
 		FGameplayEffectCustomExecutionOutput& OutExecutionOutput
 	) const override;
+
+	/**
+	 * Checks a spec's asset tags (dynamic + effect definition) for a tag without
+	 * copying them into a temporary container.
+	 *
+	 * @param Spec - Spec to check
+	 * @param Tag - Tag to look for (parent tags match their children)
+	 * @return True if either tag source has the tag
+	 */
+	static bool SpecHasAssetTag(const FGameplayEffectSpec& Spec, const FGameplayTag& Tag);
+
+	/**
+	 * Final damage for one hit: Data.Damage times Scale and the attacker's stats, then the combos that fire,
+	 * then the defender's reductions.
+	 * Pure function of its inputs - safe on any thread once Combos is prepared.
+	 *
+	 * @param Spec - Damage spec
+	 * @param Scale - Per-target scale (the Data.Falloff magnitude)
+	 * @param Attributes - Attacker and defender stats for this hit
+	 * @param TargetTags - Target's explicit owned tags (null = no combos)
+	 * @param Combos - Lookup from GetComboLookup
+	 * @param OutCombo - Combos that fired
+	 * @return Damage to subtract from Health
+	 */
+	static float CalculateDamage(const FGameplayEffectSpec& Spec, float Scale, const FNeonDamageAttributes& Attributes,
+		const FGameplayTagContainer* TargetTags, const FNeonComboLookup& Combos, FNeonComboResult& OutCombo);
+
+	/** Attacker stats snapshotted into the spec (neutral if it was built without a source ASC) */
+	static void CaptureSourceAttributes(const FGameplayEffectSpec& Spec, FNeonDamageAttributes& OutAttributes);
+
+	/** Defender stats captured into the spec GAS applies to the target */
+	static void CaptureTargetAttributes(const FGameplayEffectSpec& Spec, FNeonDamageAttributes& OutAttributes);
+
+	/** Defender stats from the target's current values, for damage resolved before the spec reaches the target */
+	static void ReadTargetAttributes(const UAbilitySystemComponent& TargetASC, const FGameplayEffectSpec& Spec, FNeonDamageAttributes& OutAttributes);
+
+	/**
+	 * Configured combo lookup if the table is resident, otherwise the built-in one. Never loads synchronously:
+	 * a missing table is requested from WorldContext's UNeonAssetPreloadSubsystem. Game thread only (may rebake).
+	 *
+	 * @param WorldContext - Object in the world the hit happens in (may be null)
+	 */
+	const FNeonComboLookup& GetComboLookup(const UObject* WorldContext) const;
+
+	/** Assets the exec needs resident before combat (the configured combo table) */
+	void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
+	/** Records a fired combo in the target world's combat event ring */
+	static void RecordComboEvent(AActor* Source, AActor* Target, float Damage, const FNeonComboResult& Combo);
+
+protected:
+	/** Combo rules; leave empty to use the built-in Neon vs Corrupted rule */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Combos")
+	TSoftObjectPtr<UNeonComboTable> ComboTable;
+
+private:
+	/** Configured combo table if it is loaded (nullptr if none is configured or it is still streaming) */
+	const UNeonComboTable* GetComboTable(const UObject* WorldContext) const;
 };
\ No newline at end of file
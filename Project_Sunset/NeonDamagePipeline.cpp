@@ -0,0 +1,165 @@
+#include "NeonDamagePipeline.h"
+#include "NeonDamageExecCalculation.h"
+#include "NeonEffectLibrary.h"
+#include "NeonGameplayTags.h"
+#include "NeonCombatLog.h"
+#include "NeonCombatStats.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+// Resolving one hit is a few multiplies and a combo lookup over the target's tags, a microsecond or two.
+// Waking workers and waiting on them costs more than that times a dozen or so targets, so small batches stay inline.
+static TAutoConsoleVariable<int32> CVarNeonDamageParallelMinTargets(
+	TEXT("neon.Damage.ParallelMinTargets"),
+	16,
+	TEXT("Targets a damage batch needs before its damage is resolved on worker threads (smaller batches resolve on the game thread)."),
+	ECVF_Default
+);
+
+/**
+ * One target of a damage batch, filled in by stages 1 and 2.
+ */
+struct FNeonDamagePipelineHit
+{
+	UAbilitySystemComponent* TargetASC = nullptr;
+	const FGameplayTagContainer* TargetTags = nullptr;
+	float Scale = 1.f;
+	FNeonDamageAttributes Attributes;
+	float Damage = 0.f;
+	FNeonComboResult Combo;
+};
+
+/**
+ * Subclasses of the damage exec count too - they share its combo resolution.
+ * Only instant effects qualify: a duration or periodic effect would keep the damage resolved at apply time
+ * for every period, skipping the combo checks and the target's current Defense/NeonResistance.
+ */
+const UNeonDamageExecCalculation* FNeonDamagePipeline::FindDamageExec(const FGameplayEffectSpec& Spec)
+{
+	const UGameplayEffect* Effect = Spec.Def;
+	if (!Effect || Effect->DurationPolicy != EGameplayEffectDurationType::Instant)
+	{
+		return nullptr;
+	}
+
+	for (const FGameplayEffectExecutionDefinition& Execution : Effect->Executions)
+	{
+		const UClass* CalculationClass = Execution.CalculationClass;
+		if (CalculationClass && CalculationClass->IsChildOf(UNeonDamageExecCalculation::StaticClass()))
+		{
+			return CalculationClass->GetDefaultObject<UNeonDamageExecCalculation>();
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Stage 2 is the only part off the game thread. Counters, combo events and the GAS application all
+ * stay in stage 3, which walks the hits in the caller's order.
+ */
+int32 FNeonDamagePipeline::ApplyToTargets(
+	FGameplayEffectSpec& Spec,
+	const UNeonDamageExecCalculation& DamageExec,
+	TArrayView<UAbilitySystemComponent* const> TargetASCs,
+	TArrayView<const float> Scales)
+{
+	check(IsInGameThread());
+	check(Scales.Num() == 0 || Scales.Num() >= TargetASCs.Num());
+
+	NEON_COMBAT_SCOPE(STAT_NeonDamagePipeline);
+
+	// ========================================
+	// Stage 1: Gather
+	// ========================================
+
+	TArray<int32, TInlineAllocator<32>> TargetIndices;
+	UNeonEffectLibrary::GatherUniqueTargets(TargetASCs, TargetIndices);
+
+	if (TargetIndices.Num() == 0)
+	{
+		return 0;
+	}
+
+	TArray<FNeonDamagePipelineHit, TInlineAllocator<64>> Hits;
+	Hits.Reserve(TargetIndices.Num());
+
+	const float SpecScale = Spec.GetSetByCallerMagnitude(NeonGameplayTags::Data_Falloff, false, 1.0f);
+
+	// Attacker stats are snapshotted into the spec - evaluated once for the whole batch
+	FNeonDamageAttributes SourceAttributes;
+	UNeonDamageExecCalculation::CaptureSourceAttributes(Spec, SourceAttributes);
+
+	for (const int32 Index : TargetIndices)
+	{
+		UAbilitySystemComponent* TargetASC = TargetASCs[Index];
+
+		FNeonDamagePipelineHit& Hit = Hits.AddDefaulted_GetRef();
+		Hit.TargetASC = TargetASC;
+		Hit.TargetTags = &TargetASC->GetOwnedGameplayTags();
+		Hit.Scale = Scales.Num() > 0 ? Scales[Index] : SpecScale;
+		Hit.Attributes = SourceAttributes;
+		UNeonDamageExecCalculation::ReadTargetAttributes(*TargetASC, Spec, Hit.Attributes);
+	}
+
+	// ========================================
+	// Stage 2: Resolve
+	// ========================================
+
+	// Rebakes a stale lookup here, before any worker reads it
+	const FNeonComboLookup& Combos = DamageExec.GetComboLookup(Hits[0].TargetASC);
+	const FGameplayEffectSpec& ResolveSpec = Spec;
+
+	const EParallelForFlags Flags = Hits.Num() < CVarNeonDamageParallelMinTargets.GetValueOnGameThread()
+		? EParallelForFlags::ForceSingleThread
+		: EParallelForFlags::None;
+
+	ParallelFor(Hits.Num(), [&Hits, &ResolveSpec, &Combos](int32 Index)
+	{
+		FNeonDamagePipelineHit& Hit = Hits[Index];
+		Hit.Damage = FMath::Max(UNeonDamageExecCalculation::CalculateDamage(ResolveSpec, Hit.Scale, Hit.Attributes, Hit.TargetTags, Combos, Hit.Combo), 0.f);
+	}, Flags);
+
+	// ========================================
+	// Stage 3: Commit
+	// ========================================
+
+	const UAbilitySystemComponent* SourceASC = Spec.GetContext().GetInstigatorAbilitySystemComponent();
+	AActor* SourceAvatar = SourceASC ? SourceASC->GetAvatarActor() : nullptr;
+
+	int32 NumApplied = 0;
+
+	for (const FNeonDamagePipelineHit& Hit : Hits)
+	{
+		// Falloff stays on the spec for anything else reading it (cues, other modifiers)
+		if (Scales.Num() > 0)
+		{
+			Spec.SetSetByCallerMagnitude(NeonGameplayTags::Data_Falloff, Hit.Scale);
+		}
+		Spec.SetSetByCallerMagnitude(NeonGameplayTags::Data_ResolvedDamage, Hit.Damage);
+
+		// GAS can still reject the hit (immunity, application tag requirements) - then nothing was dealt or comboed
+		if (!Hit.TargetASC->ApplyGameplayEffectSpecToSelf(Spec).WasSuccessfullyApplied())
+		{
+			continue;
+		}
+
+		++NumApplied;
+
+		if (Hit.Combo.NumCombos > 0)
+		{
+			NEON_COMBAT_INC(CombosTriggered, Hit.Combo.NumCombos);
+			NEON_COMBAT_VERBOSE(TEXT(">>> COMBO TRIGGERED! %d combo(s) = %.2fx Damage + %.1f <<<"), 
+				Hit.Combo.NumCombos, Hit.Combo.Multiplier, Hit.Combo.FlatBonus);
+
+			UNeonDamageExecCalculation::RecordComboEvent(SourceAvatar, Hit.TargetASC->GetAvatarActor(), Hit.Damage, Hit.Combo);
+		}
+	}
+
+	// Specs are reused (projectile flight specs) - a leftover resolved value would skip the next exec's combos
+	Spec.SetByCallerTagMagnitudes.Remove(NeonGameplayTags::Data_ResolvedDamage);
+
+	return NumApplied;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class UAbilitySystemComponent;
+class UNeonDamageExecCalculation;
+struct FGameplayEffectSpec;
+
+/**
+ * Staged damage application for frames where one spec hits many targets (ultimate slam, boomerang sweeps).
+ *
+ * 1. Gather - null and duplicate targets are dropped, each hit notes its target's tags, stats and damage scale
+ * 2. Resolve - final damage per hit (falloff, stats and combos) with ParallelFor; it only reads the spec, the
+ *    gathered values and the baked combo lookup, so workers never write to anything shared
+ * 3. Commit - on the game thread, in target order: the spec is applied with the resolved damage as
+ *    Data.ResolvedDamage, so the exec skips straight to the Health modifier and PostGameplayEffectExecute
+ *    and the damage events fire in the same order every run
+ *
+ * Batches smaller than neon.Damage.ParallelMinTargets resolve on the game thread - fanning out a handful of
+ * hits costs more than it saves.
+ */
+struct PROJECT_SUNSET_API FNeonDamagePipeline
+{
+	/** The spec's damage exec (class default object), or null if the effect isn't instant or doesn't run UNeonDamageExecCalculation */
+	static const UNeonDamageExecCalculation* FindDamageExec(const FGameplayEffectSpec& Spec);
+
+	/**
+	 * Resolves and applies one damage spec to every target. Game thread only.
+	 *
+	 * @param Spec - Damage spec; Data.Falloff is left with the last target's scale, Data.ResolvedDamage is removed again
+	 * @param DamageExec - Exec from FindDamageExec (provides the combo lookup)
+	 * @param TargetASCs - Targets hit this frame (null and duplicate entries are skipped)
+	 * @param Scales - Damage scale per target (same order as TargetASCs); empty = the spec's own Data.Falloff
+	 * @return Number of targets GAS accepted the spec on (rejected applications record no combo)
+	 */
+	static int32 ApplyToTargets(
+		FGameplayEffectSpec& Spec,
+		const UNeonDamageExecCalculation& DamageExec,
+		TArrayView<UAbilitySystemComponent* const> TargetASCs,
+		TArrayView<const float> Scales
+	);
+};
\ No newline at end of file
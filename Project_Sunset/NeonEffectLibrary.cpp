@@ -0,0 +1,218 @@
+#include "NeonEffectLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemGlobals.h"
+#include "GameplayEffect.h"
+#include "NeonGameplayTags.h"
+#include "NeonCombatStats.h"
+#include "NeonDamagePipeline.h"
+
+/** Batches with more targets than this are deduplicated through a set instead of a linear scan */
+static constexpr int32 UniqueTargetsSetThreshold = 16;
+
+/**
+ * One context + one spec, shared by every target of the batch.
+ */
+FGameplayEffectSpecHandle UNeonEffectLibrary::MakeBatchEffectSpec(
+	UAbilitySystemComponent* SourceASC,
+	AActor* Instigator,
+	const UObject* SourceObject,
+	TSubclassOf<UGameplayEffect> EffectClass,
+	float Level,
+	float DamageMagnitude)
+{
+	if (!EffectClass)
+	{
+		return FGameplayEffectSpecHandle();
+	}
+
+	FGameplayEffectContextHandle EffectContext = SourceASC
+		? SourceASC->MakeEffectContext()
+		: FGameplayEffectContextHandle(UAbilitySystemGlobals::Get().AllocGameplayEffectContext());
+	EffectContext.AddSourceObject(SourceObject);
+
+	if (Instigator)
+	{
+		EffectContext.AddInstigator(Instigator, Instigator);
+	}
+
+	// With a source ASC, source attributes are captured here once instead of once per target
+	FGameplayEffectSpecHandle SpecHandle = SourceASC
+		? SourceASC->MakeOutgoingSpec(EffectClass, Level, EffectContext)
+		: FGameplayEffectSpecHandle(new FGameplayEffectSpec(EffectClass->GetDefaultObject<UGameplayEffect>(), EffectContext, Level));
+
+	if (SpecHandle.IsValid() && DamageMagnitude > 0.f)
+	{
+		SpecHandle.Data->SetSetByCallerMagnitude(NeonGameplayTags::Data_Damage, DamageMagnitude);
+	}
+
+	return SpecHandle;
+}
+
+/**
+ * Per-target work is only the application itself (GAS copies the spec and runs executions).
+ * Damage specs go through FNeonDamagePipeline, which resolves their damage for all targets up front.
+ */
+int32 UNeonEffectLibrary::ApplyEffectSpecToTargets(const FGameplayEffectSpecHandle& SpecHandle, TArrayView<UAbilitySystemComponent* const> TargetASCs)
+{
+	if (!SpecHandle.IsValid())
+	{
+		return 0;
+	}
+
+	FGameplayEffectSpec& Spec = *SpecHandle.Data.Get();
+
+	if (const UNeonDamageExecCalculation* DamageExec = FNeonDamagePipeline::FindDamageExec(Spec))
+	{
+		const int32 NumDamaged = FNeonDamagePipeline::ApplyToTargets(Spec, *DamageExec, TargetASCs, TArrayView<const float>());
+		NEON_COMBAT_INC(EffectsApplied, NumDamaged);
+		return NumDamaged;
+	}
+
+	TArray<int32, TInlineAllocator<32>> TargetIndices;
+	GatherUniqueTargets(TargetASCs, TargetIndices);
+
+	for (const int32 Index : TargetIndices)
+	{
+		TargetASCs[Index]->ApplyGameplayEffectSpecToSelf(Spec);
+	}
+
+	NEON_COMBAT_INC(EffectsApplied, TargetIndices.Num());
+	return TargetIndices.Num();
+}
+
+/**
+ * One spec for the whole batch - only the falloff magnitude changes between targets.
+ * Damage specs go through FNeonDamagePipeline.
+ */
+int32 UNeonEffectLibrary::ApplyEffectSpecToTargetsScaled(const FGameplayEffectSpecHandle& SpecHandle, TArrayView<UAbilitySystemComponent* const> TargetASCs, TArrayView<const float> Scales)
+{
+	if (!SpecHandle.IsValid() || !ensure(Scales.Num() >= TargetASCs.Num()))
+	{
+		return 0;
+	}
+
+	FGameplayEffectSpec& Spec = *SpecHandle.Data.Get();
+
+	if (const UNeonDamageExecCalculation* DamageExec = FNeonDamagePipeline::FindDamageExec(Spec))
+	{
+		const int32 NumDamaged = FNeonDamagePipeline::ApplyToTargets(Spec, *DamageExec, TargetASCs, Scales);
+		NEON_COMBAT_INC(EffectsApplied, NumDamaged);
+		return NumDamaged;
+	}
+
+	TArray<int32, TInlineAllocator<32>> TargetIndices;
+	GatherUniqueTargets(TargetASCs, TargetIndices);
+
+	for (const int32 Index : TargetIndices)
+	{
+		Spec.SetSetByCallerMagnitude(NeonGameplayTags::Data_Falloff, Scales[Index]);
+		TargetASCs[Index]->ApplyGameplayEffectSpecToSelf(Spec);
+	}
+
+	NEON_COMBAT_INC(EffectsApplied, TargetIndices.Num());
+	return TargetIndices.Num();
+}
+
+/**
+ * Blueprint wrapper - source ASC comes from SourceActor.
+ */
+int32 UNeonEffectLibrary::ApplyGameplayEffectToActors(
+	AActor* SourceActor,
+	TSubclassOf<UGameplayEffect> EffectClass,
+	const TArray<AActor*>& TargetActors,
+	float Level,
+	float DamageMagnitude)
+{
+	TArray<UAbilitySystemComponent*, TInlineAllocator<32>> TargetASCs;
+	GatherTargetASCs(TargetActors, TargetASCs);
+	if (TargetASCs.Num() == 0)
+	{
+		return 0;
+	}
+
+	UAbilitySystemComponent* SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(SourceActor);
+	const FGameplayEffectSpecHandle SpecHandle = MakeBatchEffectSpec(SourceASC, SourceActor, SourceActor, EffectClass, Level, DamageMagnitude);
+
+	return ApplyEffectSpecToTargets(SpecHandle, TargetASCs);
+}
+
+/**
+ * Blueprint wrapper for prebuilt specs.
+ */
+int32 UNeonEffectLibrary::ApplyEffectSpecToActors(const FGameplayEffectSpecHandle& SpecHandle, const TArray<AActor*>& TargetActors)
+{
+	TArray<UAbilitySystemComponent*, TInlineAllocator<32>> TargetASCs;
+	GatherTargetASCs(TargetActors, TargetASCs);
+
+	return ApplyEffectSpecToTargets(SpecHandle, TargetASCs);
+}
+
+/**
+ * Most batches are a handful of targets, where a linear scan beats hashing.
+ * Past UniqueTargetsSetThreshold (an AOE over a crowd) the scan would be quadratic, so a set takes over.
+ */
+void UNeonEffectLibrary::GatherUniqueTargets(TArrayView<UAbilitySystemComponent* const> TargetASCs, TArray<int32, TInlineAllocator<32>>& OutIndices)
+{
+	OutIndices.Reset();
+
+	if (TargetASCs.Num() > UniqueTargetsSetThreshold)
+	{
+		TSet<const UAbilitySystemComponent*, DefaultKeyFuncs<const UAbilitySystemComponent*>, TInlineSetAllocator<64>> Seen;
+		Seen.Reserve(TargetASCs.Num());
+
+		for (int32 Index = 0; Index < TargetASCs.Num(); ++Index)
+		{
+			bool bIsDuplicate = false;
+			if (TargetASCs[Index])
+			{
+				Seen.Add(TargetASCs[Index], &bIsDuplicate);
+				if (!bIsDuplicate)
+				{
+					OutIndices.Add(Index);
+				}
+			}
+		}
+		return;
+	}
+
+	for (int32 Index = 0; Index < TargetASCs.Num(); ++Index)
+	{
+		UAbilitySystemComponent* TargetASC = TargetASCs[Index];
+		if (!TargetASC)
+		{
+			continue;
+		}
+
+		bool bIsDuplicate = false;
+		for (int32 Previous = 0; Previous < Index; ++Previous)
+		{
+			if (TargetASCs[Previous] == TargetASC)
+			{
+				bIsDuplicate = true;
+				break;
+			}
+		}
+
+		if (!bIsDuplicate)
+		{
+			OutIndices.Add(Index);
+		}
+	}
+}
+
+/**
+ * Actors without an ASC are dropped here so the apply loop only sees real targets.
+ */
+void UNeonEffectLibrary::GatherTargetASCs(const TArray<AActor*>& TargetActors, TArray<UAbilitySystemComponent*, TInlineAllocator<32>>& OutASCs)
+{
+	OutASCs.Reset();
+
+	for (AActor* TargetActor : TargetActors)
+	{
+		if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor))
+		{
+			OutASCs.Add(TargetASC);
+		}
+	}
+}
\ No newline at end of file
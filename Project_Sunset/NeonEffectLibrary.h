@@ -0,0 +1,109 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GameplayEffectTypes.h"
+#include "NeonEffectLibrary.generated.h"
+
+// Forward declarations
+class UAbilitySystemComponent;
+class UGameplayEffect;
+
+/**
+ * Batched gameplay effect application for hits that land on many targets at once
+ * (piercing boomerangs, ground slams, AOEs).
+ *
+ * The effect context and spec are built once per (source, effect class, level) and the same spec
+ * is applied to every target. GAS copies the spec per application anyway, so sharing it is safe;
+ * what's saved is the context allocation, spec allocation, source attribute capture and
+ * SetByCaller setup that the per-target path repeated for each target.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonEffectLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Builds one outgoing spec meant to be applied to several targets.
+	 *
+	 * @param SourceASC - Attacker's ASC (may be null - a plain context is used instead)
+	 * @param Instigator - Actor credited with the effect (also the effect causer)
+	 * @param SourceObject - Object that delivered the effect (projectile, ability, AOE)
+	 * @param EffectClass - Effect to build
+	 * @param Level - Effect level
+	 * @param DamageMagnitude - Data.Damage SetByCaller magnitude; <= 0 leaves it unset
+	 * @return Spec handle, invalid if EffectClass is null
+	 */
+	static FGameplayEffectSpecHandle MakeBatchEffectSpec(
+		UAbilitySystemComponent* SourceASC,
+		AActor* Instigator,
+		const UObject* SourceObject,
+		TSubclassOf<UGameplayEffect> EffectClass,
+		float Level = 1.f,
+		float DamageMagnitude = 0.f
+	);
+
+	/**
+	 * Applies one spec to every target ASC. Null and duplicate targets are skipped.
+	 * Specs that run UNeonDamageExecCalculation resolve their damage through FNeonDamagePipeline.
+	 *
+	 * @param SpecHandle - Spec built by MakeBatchEffectSpec (or any outgoing spec)
+	 * @param TargetASCs - Targets hit this frame
+	 * @return Number of targets the spec was applied to
+	 */
+	static int32 ApplyEffectSpecToTargets(const FGameplayEffectSpecHandle& SpecHandle, TArrayView<UAbilitySystemComponent* const> TargetASCs);
+
+	/**
+	 * Same as ApplyEffectSpecToTargets, but sets the Data.Falloff SetByCaller per target before applying.
+	 * The spec is left with the last target's scale.
+	 *
+	 * @param SpecHandle - Spec built by MakeBatchEffectSpec (or any outgoing spec)
+	 * @param TargetASCs - Targets hit this frame
+	 * @param Scales - Damage scale per target (same order as TargetASCs)
+	 * @return Number of targets the spec was applied to
+	 */
+	static int32 ApplyEffectSpecToTargetsScaled(const FGameplayEffectSpecHandle& SpecHandle, TArrayView<UAbilitySystemComponent* const> TargetASCs, TArrayView<const float> Scales);
+
+	/**
+	 * Indices of the targets a batch applies to: nulls and repeats of an earlier entry are dropped,
+	 * the remaining targets keep their input order.
+	 *
+	 * @param TargetASCs - Targets hit this frame
+	 * @param OutIndices - Receives indices into TargetASCs (reset first)
+	 */
+	static void GatherUniqueTargets(TArrayView<UAbilitySystemComponent* const> TargetASCs, TArray<int32, TInlineAllocator<32>>& OutIndices);
+
+	/**
+	 * Blueprint entry point: builds one spec from SourceActor's ASC and applies it to every target actor.
+	 *
+	 * @param SourceActor - Attacker (instigator and effect causer)
+	 * @param EffectClass - Effect to apply
+	 * @param TargetActors - Actors hit; actors without an ASC are skipped
+	 * @param Level - Effect level
+	 * @param DamageMagnitude - Data.Damage SetByCaller magnitude; <= 0 leaves it unset
+	 * @return Number of targets the effect was applied to
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ability|Gameplay Effects", Meta = (DefaultToSelf = "SourceActor"))
+	static int32 ApplyGameplayEffectToActors(
+		AActor* SourceActor,
+		TSubclassOf<UGameplayEffect> EffectClass,
+		const TArray<AActor*>& TargetActors,
+		float Level = 1.f,
+		float DamageMagnitude = 0.f
+	);
+
+	/**
+	 * Blueprint entry point for a prebuilt spec (e.g. from UBaseTelegraphAbility::MakeDamageEffectSpec).
+	 *
+	 * @param SpecHandle - Spec to apply
+	 * @param TargetActors - Actors hit; actors without an ASC are skipped
+	 * @return Number of targets the spec was applied to
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Ability|Gameplay Effects")
+	static int32 ApplyEffectSpecToActors(const FGameplayEffectSpecHandle& SpecHandle, const TArray<AActor*>& TargetActors);
+
+private:
+	/** Resolves target actors to ASCs into a reusable scratch array */
+	static void GatherTargetASCs(const TArray<AActor*>& TargetActors, TArray<UAbilitySystemComponent*, TInlineAllocator<32>>& OutASCs);
+};
\ No newline at end of file
@@ -0,0 +1,10 @@
+#include "NeonGameplayTags.h"
+
+namespace NeonGameplayTags
+{
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Status_Corrupted, "Status.Corrupted", "Target is corrupted; Neon damage against it triggers the combo");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Damage_Type_Neon, "Damage.Type.Neon", "Neon-type damage");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Damage, "Data.Damage", "SetByCaller base damage for UNeonDamageExecCalculation");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_Falloff, "Data.Falloff", "SetByCaller per-target damage scale (AOE falloff)");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Data_ResolvedDamage, "Data.ResolvedDamage", "SetByCaller final damage resolved ahead by the damage pipeline (combos and falloff included)");
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NativeGameplayTags.h"
+
+/**
+ * Native gameplay tags used by C++ combat code.
+ *
+ * Registered with the tag manager when the module loads, so code holds the
+ * resolved FGameplayTag directly instead of calling RequestGameplayTag
+ * (an FName construction plus a tag manager lookup) on every use.
+ */
+namespace NeonGameplayTags
+{
+	// ========================================
+	// Status
+	// ========================================
+
+	/** Target is corrupted (applied by the boomerang's outgoing phase) */
+	PROJECT_SUNSET_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Status_Corrupted);
+
+	// ========================================
+	// Damage Types
+	// ========================================
+
+	/** Neon damage - triggers the combo against corrupted targets */
+	PROJECT_SUNSET_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Damage_Type_Neon);
+
+	// ========================================
+	// SetByCaller Data
+	// ========================================
+
+	/** Base damage magnitude passed to UNeonDamageExecCalculation */
+	PROJECT_SUNSET_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Damage);
+
+	/** Per-target damage scale (AOE falloff), defaults to 1 when unset */
+	PROJECT_SUNSET_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Falloff);
+
+	/** Final per-target damage resolved by FNeonDamagePipeline; the exec applies it as is */
+	PROJECT_SUNSET_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_ResolvedDamage);
+}
\ No newline at end of file
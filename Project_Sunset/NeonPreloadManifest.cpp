@@ -0,0 +1,63 @@
+#include "NeonPreloadManifest.h"
+#include "Abilities/GameplayAbility.h"
+#include "BaseTelegraphAbility.h"
+#include "NeonProjectile.h"
+
+/**
+ * Null entries (unset array slots) are skipped.
+ */
+void UNeonPreloadManifest::GetDirectAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const TSoftClassPtr<UGameplayAbility>& Ability : Abilities)
+	{
+		if (!Ability.IsNull())
+		{
+			OutAssets.AddUnique(Ability.ToSoftObjectPath());
+		}
+	}
+
+	for (const TSoftClassPtr<ANeonProjectile>& Projectile : Projectiles)
+	{
+		if (!Projectile.IsNull())
+		{
+			OutAssets.AddUnique(Projectile.ToSoftObjectPath());
+		}
+	}
+
+	for (const TSoftObjectPtr<UObject>& Asset : ExtraAssets)
+	{
+		if (!Asset.IsNull())
+		{
+			OutAssets.AddUnique(Asset.ToSoftObjectPath());
+		}
+	}
+}
+
+/**
+ * Asks each loaded class's defaults for the assets it references softly.
+ * Classes that failed to load are skipped.
+ */
+void UNeonPreloadManifest::GetDependentAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const TSoftClassPtr<UGameplayAbility>& Ability : Abilities)
+	{
+		if (const UClass* AbilityClass = Ability.Get())
+		{
+			if (const UBaseTelegraphAbility* TelegraphAbility = Cast<UBaseTelegraphAbility>(AbilityClass->GetDefaultObject()))
+			{
+				TelegraphAbility->GetPreloadAssets(OutAssets);
+			}
+		}
+	}
+
+	for (const TSoftClassPtr<ANeonProjectile>& Projectile : Projectiles)
+	{
+		if (const UClass* ProjectileClass = Projectile.Get())
+		{
+			if (const ANeonProjectile* ProjectileDefaults = Cast<ANeonProjectile>(ProjectileClass->GetDefaultObject()))
+			{
+				ProjectileDefaults->GetPreloadAssets(OutAssets);
+			}
+		}
+	}
+}
\ No newline at end of file
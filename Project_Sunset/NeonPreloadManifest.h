@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "NeonPreloadManifest.generated.h"
+
+// Forward declarations
+class UGameplayAbility;
+class ANeonProjectile;
+
+/**
+ * Everything a character needs in memory before it can fight: its abilities, the projectiles they fire,
+ * and any extra assets. Only soft references are stored, so the manifest itself costs nothing to load.
+ *
+ * Loading is two passes (see UNeonAssetPreloadSubsystem):
+ * 1. The listed classes and assets
+ * 2. The soft references held by those classes' defaults (telegraph meshes, gameplay effects, ...)
+ */
+UCLASS(BlueprintType)
+class PROJECT_SUNSET_API UNeonPreloadManifest : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Abilities the character can activate */
+	UPROPERTY(EditDefaultsOnly, Category = "Preload")
+	TArray<TSoftClassPtr<UGameplayAbility>> Abilities;
+
+	/** Projectiles those abilities fire */
+	UPROPERTY(EditDefaultsOnly, Category = "Preload")
+	TArray<TSoftClassPtr<ANeonProjectile>> Projectiles;
+
+	/** Anything else that must not be sync-loaded mid-fight (sounds, VFX, montages) */
+	UPROPERTY(EditDefaultsOnly, Category = "Preload")
+	TArray<TSoftObjectPtr<UObject>> ExtraAssets;
+
+	/** Pass 1: the listed classes and assets */
+	void GetDirectAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
+	/** Pass 2: soft references held by the defaults of the (already loaded) listed classes */
+	void GetDependentAssets(TArray<FSoftObjectPath>& OutAssets) const;
+};
\ No newline at end of file
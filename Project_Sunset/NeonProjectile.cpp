@@ -5,13 +5,45 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "GameFramework/Character.h"
+#include "NeonProjectilePoolSubsystem.h"
+#include "NeonProjectileSimSubsystem.h"
+#include "NeonCombatPawnRegistry.h"
+#include "PlayerCharacter.h"
+#include "NeonCombatLog.h"
+#include "NeonCombatStats.h"
+#include "NeonEffectLibrary.h"
+#include "NeonAssetPreloadSubsystem.h"
+#include "NeonCombatEventSubsystem.h"
+#include "NeonGameplayTags.h"
+#include "NeonReplaySubsystem.h"
+#include "TimerManager.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+static TAutoConsoleVariable<bool> CVarNeonForceSpatialHashHits(
+	TEXT("neon.Projectile.ForceSpatialHashHits"),
+	false,
+	TEXT("Force every projectile to detect pawn hits through the combat pawn spatial hash instead of physics overlaps."),
+	ECVF_Default
+);
+
+/**
+ * Server world time as this machine knows it (synced through the game state on clients).
+ */
+static double GetServerWorldTime(const UWorld* World)
+{
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
 
 /**
  * Constructor - Sets up all components and default values.
  */
 ANeonProjectile::ANeonProjectile()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Movement and phase logic run in UNeonProjectileSimSubsystem
+	PrimaryActorTick.bCanEverTick = false;
 
 	// ========================================
 	// Collision Component Setup
@@ -48,78 +80,208 @@ ANeonProjectile::ANeonProjectile()
 	ProjectileMovement->MaxSpeed = 2000.f;
 	ProjectileMovement->bRotationFollowsVelocity = true; // Face direction of travel
 	ProjectileMovement->ProjectileGravityScale = 0.f; // No gravity
+	ProjectileMovement->bAutoActivate = false; // Settings only - the simulation manager moves us
 	
 	// Auto-destroy after 10 seconds to prevent infinite projectiles
 	InitialLifeSpan = 10.0f;
+
+	// ========================================
+	// Replication
+	// ========================================
+	// Clients rebuild the flight from LaunchState; the movement itself never replicates
+	bReplicates = true;
+	SetReplicatingMovement(false);
+}
+
+/**
+ * LaunchState is push based - it only changes when a flight starts or ends.
+ */
+void ANeonProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ANeonProjectile, LaunchState, Params);
 }
 
 /**
  * Called when the actor is spawned.
- * Binds collision event handlers.
+ * Binds collision event handlers and starts simulating.
  */
 void ANeonProjectile::BeginPlay()
 {
 	Super::BeginPlay();
 	
+	MeshRestLocation = MeshComponent->GetRelativeLocation();
+
 	// Bind collision callbacks
 	CollisionComponent->OnComponentHit.AddDynamic(this, &ANeonProjectile::OnProjectileHit);
 	CollisionComponent->OnComponentBeginOverlap.AddDynamic(this, &ANeonProjectile::OnProjectileOverlap);
+
+	// Pooled projectiles are parked right after spawning; they start simulating in ActivateProjectile.
+	// Replicas start from OnRep_LaunchState instead.
+	if (bIsActiveInWorld && HasAuthority())
+	{
+		StartSimulation();
+		BuildFlightEffectSpecs();
+	}
+}
+
+/**
+ * Called when the actor is destroyed or the level ends.
+ */
+void ANeonProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopSimulation();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+/**
+ * Called by the simulation manager when an outgoing boomerang has traveled MaxTravelDistance.
+ * The manager has already switched the slot to homing; this mirrors the phase on the actor.
+ */
+void ANeonProjectile::HandleReturnPhaseStarted()
+{
+	NEON_COMBAT_VERBOSE(TEXT("=== BOOMERANG ENTERING RETURN PHASE (Distance) ==="));
+	
+	// Switch to return phase
+	BoomerangPhase = EProjectilePhase::Returning;
+	
+	// Clear hit list so enemies can be hit again on return
+	ResetHitsForPhase(EProjectilePhase::Returning);
+	RecordPhaseEvent(ENeonCombatEventType::BoomerangPhase);
+}
+
+/**
+ * Called by the simulation manager when a returning boomerang is within ReturnCatchRadius of its owner.
+ */
+void ANeonProjectile::HandleReturnedToOwner()
+{
+	NEON_COMBAT_VERBOSE(TEXT("Boomerang returned to owner - releasing"));
+	RecordPhaseEvent(ENeonCombatEventType::BoomerangCaught);
+	ReleaseOrDestroy();
+}
+
+/**
+ * Moves the actor to its simulated transform.
+ * With bSweep the collision sphere is swept, which fires OnProjectileHit / OnProjectileOverlap.
+ */
+FVector ANeonProjectile::ApplySimulatedTransform(const FVector& NewLocation, const FRotator& NewRotation, bool bSweep)
+{
+	SetActorLocationAndRotation(NewLocation, NewRotation, bSweep);
+	return GetActorLocation();
+}
+
+/**
+ * The offset is converted into the actor's space, so it stays correct whichever way the projectile faces.
+ */
+void ANeonProjectile::ApplyRenderLocation(const FVector& RenderLocation)
+{
+	const FVector Offset = GetActorTransform().InverseTransformVector(RenderLocation - GetActorLocation());
+	MeshComponent->SetRelativeLocation(MeshRestLocation + Offset);
+}
+
+/**
+ * Projectiles with collision turned off (e.g. purely cosmetic Blueprint children) don't need sweeps,
+ * and spatial-hash projectiles resolve their hits without moving the collision component.
+ */
+bool ANeonProjectile::RequiresPhysicsSweep() const
+{
+	return GetActorEnableCollision() 
+		&& GetEffectiveHitDetectionMode() == ENeonProjectileHitDetection::PhysicsOverlap;
+}
+
+/**
+ * Spatial-hash hits only make sense while the projectile can collide at all.
+ */
+bool ANeonProjectile::UsesSpatialHashHits() const
+{
+	return GetActorEnableCollision() 
+		&& GetEffectiveHitDetectionMode() == ENeonProjectileHitDetection::SpatialHash;
+}
+
+/**
+ * Applies the console override on top of the per-projectile setting.
+ */
+ENeonProjectileHitDetection ANeonProjectile::GetEffectiveHitDetectionMode() const
+{
+	return CVarNeonForceSpatialHashHits.GetValueOnGameThread() 
+		? ENeonProjectileHitDetection::SpatialHash 
+		: HitDetectionMode;
+}
+
+/**
+ * Spatial-hash projectiles ignore pawns in physics and skip overlap updates entirely.
+ */
+void ANeonProjectile::ApplyHitDetectionMode()
+{
+	const bool bSpatialHash = GetEffectiveHitDetectionMode() == ENeonProjectileHitDetection::SpatialHash;
+	const ECollisionResponse PawnResponse = bSpatialHash ? ECR_Ignore : ECR_Overlap;
+
+	if (CollisionComponent->GetCollisionResponseToChannel(ECC_Pawn) != PawnResponse)
+	{
+		CollisionComponent->SetCollisionResponseToChannel(ECC_Pawn, PawnResponse);
+	}
+	CollisionComponent->SetGenerateOverlapEvents(!bSpatialHash);
 }
 
 /**
- * Called every frame - handles boomerang return logic.
+ * Registers with the simulation manager.
  */
-void ANeonProjectile::Tick(float DeltaTime)
+void ANeonProjectile::StartSimulation()
 {
-	Super::Tick(DeltaTime);
+	ApplyHitDetectionMode();
+
+	// New flight for clients: straight from here until LaunchBoomerang says otherwise
+	if (HasAuthority())
+	{
+		LaunchState.Location = GetActorLocation();
+		LaunchState.Direction = GetActorForwardVector();
+		LaunchState.ServerLaunchTime = GetServerWorldTime(GetWorld());
+		LaunchState.MaxTravelDistance = 0.f;
+		LaunchState.PredictionKey = 0;
+		LaunchState.bInFlight = true;
+		++LaunchState.LaunchCount;
+		MarkLaunchStateDirty();
+	}
+
+	if (UNeonProjectileSimSubsystem* Sim = GetWorld()->GetSubsystem<UNeonProjectileSimSubsystem>())
+	{
+		Sim->RegisterProjectile(this);
+	}
+}
 
-	// Only process boomerang logic if we're in boomerang mode
-	if (!bIsBoomerang || !BoomerangOwner)
+/**
+ * Unregisters from the simulation manager.
+ */
+void ANeonProjectile::StopSimulation()
+{
+	if (SimSlotIndex == INDEX_NONE)
 	{
 		return;
 	}
 
-	// ========================================
-	// Outgoing Phase Logic
-	// ========================================
-	if (BoomerangPhase == EProjectilePhase::Outgoing)
+	if (UNeonProjectileSimSubsystem* Sim = GetWorld()->GetSubsystem<UNeonProjectileSimSubsystem>())
 	{
-		// Check if we've traveled far enough to start returning
-		float DistanceTraveled = FVector::Dist(BoomerangStartLocation, GetActorLocation());
-		
-		if (DistanceTraveled >= MaxTravelDistance)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("=== BOOMERANG ENTERING RETURN PHASE (Distance) ==="));
-			
-			// Switch to return phase
-			BoomerangPhase = EProjectilePhase::Returning;
-			
-			// Clear hit list so enemies can be hit again on return
-			HitActorsThisPhase.Empty();
-			
-			// Enable homing to return to owner
-			if (ProjectileMovement)
-			{
-				ProjectileMovement->bIsHomingProjectile = true;
-				ProjectileMovement->HomingAccelerationMagnitude = 8000.f; // Strong homing to prevent orbit
-				ProjectileMovement->HomingTargetComponent = BoomerangOwner->GetRootComponent();
-			}
-		}
+		Sim->UnregisterProjectile(this);
 	}
-	// ========================================
-	// Returning Phase Logic
-	// ========================================
-	else if (BoomerangPhase == EProjectilePhase::Returning)
+
+	SimSlotIndex = INDEX_NONE;
+}
+
+/**
+ * Reads the velocity back from the simulation manager.
+ */
+FVector ANeonProjectile::GetSimulatedVelocity() const
+{
+	if (const UNeonProjectileSimSubsystem* Sim = GetWorld()->GetSubsystem<UNeonProjectileSimSubsystem>())
 	{
-		// Check if we're close enough to owner to destroy
-		float DistanceToOwner = FVector::Dist(GetActorLocation(), BoomerangOwner->GetActorLocation());
-		
-		if (DistanceToOwner < 100.f)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Boomerang returned to owner - destroying"));
-			Destroy();
-		}
+		return Sim->GetSimulatedVelocity(this);
 	}
+
+	return FVector::ZeroVector;
 }
 
 /**
@@ -128,7 +290,7 @@ void ANeonProjectile::Tick(float DeltaTime)
  */
 void ANeonProjectile::InitializeBoomerang(AActor* InOwner, float InMaxDistance)
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== InitializeBoomerang called ==="));
+	NEON_COMBAT_VERBOSE(TEXT("=== InitializeBoomerang called ==="));
 	
 	// Set boomerang parameters
 	bIsBoomerang = true;
@@ -136,26 +298,470 @@ void ANeonProjectile::InitializeBoomerang(AActor* InOwner, float InMaxDistance)
 	MaxTravelDistance = InMaxDistance;
 	BoomerangStartLocation = GetActorLocation();
 	BoomerangPhase = EProjectilePhase::Outgoing;
-	HitActorsThisPhase.Empty();
+	ResetHitsForPhase(EProjectilePhase::Outgoing);
+	ResetHitsForPhase(EProjectilePhase::Returning);
+	
+	// Hand the new settings to our simulation slot (straight flight until the return phase)
+	if (UNeonProjectileSimSubsystem* Sim = GetWorld()->GetSubsystem<UNeonProjectileSimSubsystem>())
+	{
+		Sim->SyncBoomerangState(this);
+	}
+
+	if (UNeonReplaySubsystem* Replay = GetWorld()->GetSubsystem<UNeonReplaySubsystem>())
+	{
+		Replay->RecordProjectileSpawn(this, InOwner, InMaxDistance);
+	}
+
+	// Effect classes and damage are often set between activation and here - rebuilds only the specs that changed
+	BuildFlightEffectSpecs();
 	
 	// Configure for straight outgoing flight
 	if (ProjectileMovement)
 	{
-		ProjectileMovement->bIsHomingProjectile = false; // Straight flight initially
-		ProjectileMovement->HomingAccelerationMagnitude = 0.f;
 		ProjectileMovement->InitialSpeed = 2000.f;
 		ProjectileMovement->MaxSpeed = 2000.f;
 		ProjectileMovement->ProjectileGravityScale = 0.f;
 		
-		UE_LOG(LogTemp, Warning, TEXT("Boomerang configured: MaxDistance=%.0f, Speed=%.0f"), 
+		NEON_COMBAT_VERBOSE(TEXT("Boomerang configured: MaxDistance=%.0f, Speed=%.0f"), 
 			InMaxDistance, ProjectileMovement->InitialSpeed);
 	}
 }
 
 /**
- * Handles blocking hits (walls, obstacles).
- * Standard projectiles destroy immediately.
- * Boomerangs enter return phase if they hit a wall during outgoing flight.
+ * Server: a boomerang whose launch state replicates (optionally forward predicted).
+ * Client: a predicted stand-in, registered with the pool until the server's projectile takes it over.
+ */
+void ANeonProjectile::LaunchBoomerang(AActor* InOwner, float InMaxDistance, const FPredictionKey& PredictionKey, float ForwardPredictTime)
+{
+	InitializeBoomerang(InOwner, InMaxDistance);
+
+	LaunchState.MaxTravelDistance = InMaxDistance;
+	LaunchState.PredictionKey = PredictionKey.IsValidKey() ? PredictionKey.Current : 0;
+
+	if (GetNetMode() == NM_Client)
+	{
+		bIsPredictedFake = true;
+
+		if (UNeonProjectilePoolSubsystem* Pool = GetWorld()->GetSubsystem<UNeonProjectilePoolSubsystem>())
+		{
+			Pool->RegisterPredictedProjectile(this);
+		}
+		return;
+	}
+
+	// The predicting client launched this long ago - start where its stand-in already is
+	LaunchState.ServerLaunchTime -= ForwardPredictTime;
+	MarkLaunchStateDirty();
+
+	FastForwardFlight(ForwardPredictTime);
+}
+
+/**
+ * The outgoing leg is deterministic, so any elapsed time maps to an exact position.
+ * The server sweeps the skipped stretch so pawns and walls along it are still hit; replicas only show the flight and teleport.
+ */
+void ANeonProjectile::FastForwardFlight(float ElapsedTime)
+{
+	UNeonProjectileSimSubsystem* Sim = GetWorld()->GetSubsystem<UNeonProjectileSimSubsystem>();
+	if (ElapsedTime <= 0.f || SimSlotIndex == INDEX_NONE || !Sim)
+	{
+		return;
+	}
+
+	const float Speed = ProjectileMovement ? ProjectileMovement->InitialSpeed : 2000.f;
+	const FVector Direction = GetActorForwardVector();
+
+	float Distance = Speed * ElapsedTime;
+	const bool bReachedTurn = bIsBoomerang && Distance >= MaxTravelDistance;
+	if (bReachedTurn)
+	{
+		Distance = MaxTravelDistance;
+	}
+
+	FVector Location = GetActorLocation() + Direction * Distance;
+
+	if (HasAuthority())
+	{
+		Location = Sim->SweepProjectile(this, Location, Direction * Speed);
+
+		// A hit ended the flight, or a wall already turned the boomerang around
+		if (SimSlotIndex == INDEX_NONE || BoomerangPhase == EProjectilePhase::Returning)
+		{
+			return;
+		}
+
+		SetActorLocation(Location, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+	else
+	{
+		SetActorLocation(Location, false, nullptr, ETeleportType::TeleportPhysics);
+		Sim->TeleportProjectile(this, Location, Direction * Speed);
+	}
+
+	if (bReachedTurn)
+	{
+		BoomerangPhase = EProjectilePhase::Returning;
+		ResetHitsForPhase(EProjectilePhase::Returning);
+		Sim->ForceReturnPhase(this);
+	}
+}
+
+/**
+ * Replicas fly locally from the launch state. A flight already started for this LaunchCount is left alone.
+ */
+void ANeonProjectile::OnRep_LaunchState()
+{
+	if (!LaunchState.bInFlight)
+	{
+		EndClientFlight();
+		return;
+	}
+
+	if (bIsActiveInWorld && SimSlotIndex != INDEX_NONE && AppliedLaunchCount == LaunchState.LaunchCount)
+	{
+		return;
+	}
+	AppliedLaunchCount = LaunchState.LaunchCount;
+
+	ResetProjectile();
+	bIsActiveInWorld = true;
+
+	SetActorTransform(FTransform(LaunchState.Direction.Rotation(), LaunchState.Location), false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	StartSimulation();
+
+	if (LaunchState.MaxTravelDistance > 0.f)
+	{
+		InitializeBoomerang(GetOwner(), LaunchState.MaxTravelDistance);
+	}
+
+	FastForwardFlight(static_cast<float>(GetServerWorldTime(GetWorld()) - LaunchState.ServerLaunchTime));
+
+	// Our own predicted shot - take over the stand-in the player has been watching
+	if (LaunchState.PredictionKey != 0)
+	{
+		if (UNeonProjectilePoolSubsystem* Pool = GetWorld()->GetSubsystem<UNeonProjectilePoolSubsystem>())
+		{
+			AdoptPredictedFake(Pool->TakePredictedProjectile(GetInstigator(), LaunchState.PredictionKey));
+		}
+	}
+}
+
+/**
+ * Small disagreements keep the stand-in's position (no visible pop); larger ones snap to the server's flight.
+ * Either way the stand-in's hits carry over, so hit cosmetics don't play twice.
+ */
+void ANeonProjectile::AdoptPredictedFake(ANeonProjectile* Fake)
+{
+	if (!Fake || Fake == this)
+	{
+		return;
+	}
+
+	for (int32 PhaseIndex = 0; PhaseIndex < 2; ++PhaseIndex)
+	{
+		HitPawnBits[PhaseIndex] = Fake->HitPawnBits[PhaseIndex];
+		HitPawnGenerations[PhaseIndex] = Fake->HitPawnGenerations[PhaseIndex];
+		HitUnregisteredActors[PhaseIndex] = Fake->HitUnregisteredActors[PhaseIndex];
+	}
+
+	const FVector FakeLocation = Fake->GetActorLocation();
+	const bool bAgrees = Fake->BoomerangPhase == BoomerangPhase
+		&& FVector::DistSquared(FakeLocation, GetActorLocation()) <= FMath::Square(ReconcileTolerance);
+
+	UNeonProjectileSimSubsystem* Sim = GetWorld()->GetSubsystem<UNeonProjectileSimSubsystem>();
+	if (bAgrees && Sim && SimSlotIndex != INDEX_NONE)
+	{
+		SetActorLocation(FakeLocation, false, nullptr, ETeleportType::TeleportPhysics);
+		Sim->TeleportProjectile(this, FakeLocation, Fake->GetSimulatedVelocity());
+	}
+	else
+	{
+		NEON_COMBAT_VERBOSE(TEXT("Predicted projectile %s corrected by %.0f"), *GetName(), FVector::Dist(FakeLocation, GetActorLocation()));
+	}
+
+	Fake->ReleaseOrDestroy();
+}
+
+/**
+ * Stops simulating and hides; the server decides when the actor is pooled or destroyed.
+ */
+void ANeonProjectile::EndClientFlight()
+{
+	if (!bIsActiveInWorld)
+	{
+		return;
+	}
+
+	bIsActiveInWorld = false;
+	StopSimulation();
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+}
+
+/**
+ * Effects are server-authoritative; predicted stand-ins are client-local actors with local authority, so check both.
+ */
+bool ANeonProjectile::ShouldApplyEffects() const
+{
+	return HasAuthority() && !bIsPredictedFake;
+}
+
+/**
+ * Push-model dirty marking (plain property comparison when push model is off).
+ */
+void ANeonProjectile::MarkLaunchStateDirty()
+{
+	MARK_PROPERTY_DIRTY_FROM_NAME(ANeonProjectile, LaunchState, this);
+}
+
+/**
+ * Projectile is the event target, its owner the source.
+ */
+void ANeonProjectile::RecordPhaseEvent(ENeonCombatEventType Type)
+{
+	if (UNeonCombatEventSubsystem* CombatEvents = GetWorld()->GetSubsystem<UNeonCombatEventSubsystem>())
+	{
+		const AActor* Owner = GetOwner();
+		const float OwnerDistance = Owner ? FVector::Dist(GetActorLocation(), Owner->GetActorLocation()) : 0.f;
+		CombatEvents->RecordEvent(Type, GetOwner(), this, OwnerDistance, FGameplayTag(), static_cast<uint8>(BoomerangPhase));
+	}
+}
+
+/**
+ * Resets all per-flight state back to class defaults.
+ * Used by the pool so a reused projectile behaves exactly like a new spawn.
+ */
+void ANeonProjectile::ResetProjectile()
+{
+	const ANeonProjectile* Defaults = GetDefault<ANeonProjectile>(GetClass());
+
+	// Boomerang state
+	bIsBoomerang = Defaults->bIsBoomerang;
+	BoomerangOwner = nullptr;
+	MaxTravelDistance = Defaults->MaxTravelDistance;
+	BoomerangStartLocation = FVector::ZeroVector;
+	BoomerangPhase = EProjectilePhase::Outgoing;
+	
+	// Drop any render offset left over from the last flight
+	MeshComponent->SetRelativeLocation(MeshRestLocation);
+
+	// Keep the allocations - the next flight will likely hit a similar number of actors
+	ResetHitsForPhase(EProjectilePhase::Outgoing);
+	ResetHitsForPhase(EProjectilePhase::Returning);
+
+	// Next flight may have a different owner or effects
+	FlightDamageSpec.Clear();
+	FlightCorruptionSpec.Clear();
+}
+
+/**
+ * Puts a pooled projectile back into play at the launch transform.
+ */
+void ANeonProjectile::ActivateProjectile(const FTransform& LaunchTransform)
+{
+	ResetProjectile();
+	bIsActiveInWorld = true;
+
+	// Move while collision is still off so we don't sweep/overlap from the parked location
+	SetActorTransform(LaunchTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetNetDormancy(DORM_Awake);
+
+	// Re-arm movement: a fresh simulation slot launches us forward at InitialSpeed
+	StartSimulation();
+
+	BuildFlightEffectSpecs();
+
+	// Pooled projectiles can't use actor lifespan (it destroys), so use a timer that releases instead
+	if (bIsPooled && InitialLifeSpan > 0.f)
+	{
+		GetWorldTimerManager().SetTimer(
+			PooledLifeSpanTimerHandle, 
+			this, 
+			&ANeonProjectile::ReleaseOrDestroy, 
+			InitialLifeSpan, 
+			false
+		);
+	}
+}
+
+/**
+ * Parks the projectile so it costs nothing while waiting in the pool.
+ */
+void ANeonProjectile::DeactivateProjectile()
+{
+	bIsActiveInWorld = false;
+
+	GetWorldTimerManager().ClearTimer(PooledLifeSpanTimerHandle);
+
+	// Cancel the lifespan set by BeginPlay for freshly spawned pooled projectiles
+	SetLifeSpan(0.f);
+
+	StopSimulation();
+
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+
+	if (bIsPredictedFake)
+	{
+		if (UNeonProjectilePoolSubsystem* Pool = GetWorld()->GetSubsystem<UNeonProjectilePoolSubsystem>())
+		{
+			Pool->UnregisterPredictedProjectile(this);
+		}
+		bIsPredictedFake = false;
+	}
+
+	if (HasAuthority())
+	{
+		LaunchState.bInFlight = false;
+		MarkLaunchStateDirty();
+
+		// Parked projectiles cost the server nothing; the final state replicates before the channel goes dormant
+		SetNetDormancy(DORM_DormantAll);
+	}
+
+	// Drop references so parked projectiles don't keep owners alive
+	ResetProjectile();
+}
+
+/**
+ * Ends the current flight - back to the pool if pooled, otherwise destroyed.
+ */
+void ANeonProjectile::ReleaseOrDestroy()
+{
+	// Replicas only stop locally; the server releases or destroys the actor
+	if (!HasAuthority())
+	{
+		EndClientFlight();
+		return;
+	}
+
+	if (!bIsPooled)
+	{
+		Destroy();
+		return;
+	}
+
+	if (UNeonProjectilePoolSubsystem* Pool = GetWorld()->GetSubsystem<UNeonProjectilePoolSubsystem>())
+	{
+		Pool->ReleaseProjectile(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+/**
+ * Blueprint-facing once-per-phase query.
+ */
+bool ANeonProjectile::WasActorHitThisPhase(AActor* Actor) const
+{
+	return Actor && HasHitThisPhase(Actor, GetCombatPawnIndex(Actor));
+}
+
+/**
+ * Combat pawns carry their registry slot; everything else has none.
+ */
+int32 ANeonProjectile::GetCombatPawnIndex(const AActor* Actor)
+{
+	const APlayerCharacter* Pawn = Cast<APlayerCharacter>(Actor);
+	return Pawn ? Pawn->GetCombatRegistryIndex() : INDEX_NONE;
+}
+
+/**
+ * Bit test for registered pawns (plus a generation check when the bit is set), short linear scan for anything else.
+ */
+bool ANeonProjectile::HasHitThisPhase(const AActor* Actor, int32 PawnIndex) const
+{
+	const int32 PhaseIndex = static_cast<int32>(BoomerangPhase);
+
+	if (PawnIndex != INDEX_NONE)
+	{
+		const TBitArray<TInlineAllocator<4>>& Bits = HitPawnBits[PhaseIndex];
+		if (PawnIndex >= Bits.Num() || !Bits[PawnIndex])
+		{
+			return false;
+		}
+
+		// The bit may belong to an earlier pawn in a reused slot
+		const uint32 Generation = static_cast<const APlayerCharacter*>(Actor)->GetCombatRegistryGeneration();
+		for (const FPawnHit& Hit : HitPawnGenerations[PhaseIndex])
+		{
+			if (Hit.PawnIndex == PawnIndex)
+			{
+				return Hit.Generation == Generation;
+			}
+		}
+		return false;
+	}
+
+	for (const TWeakObjectPtr<AActor>& HitActor : HitUnregisteredActors[PhaseIndex])
+	{
+		if (HitActor.Get() == Actor)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Sets the pawn's bit (growing the bitset on demand) and records its slot generation, or remembers the unregistered actor.
+ */
+void ANeonProjectile::MarkHitThisPhase(AActor* Actor, int32 PawnIndex)
+{
+	const int32 PhaseIndex = static_cast<int32>(BoomerangPhase);
+
+	if (PawnIndex != INDEX_NONE)
+	{
+		TBitArray<TInlineAllocator<4>>& Bits = HitPawnBits[PhaseIndex];
+		if (PawnIndex >= Bits.Num())
+		{
+			Bits.Add(false, PawnIndex + 1 - Bits.Num());
+		}
+
+		const uint32 Generation = static_cast<const APlayerCharacter*>(Actor)->GetCombatRegistryGeneration();
+		if (Bits[PawnIndex])
+		{
+			// Slot was reused since its last hit - the entry now belongs to the new pawn
+			for (FPawnHit& Hit : HitPawnGenerations[PhaseIndex])
+			{
+				if (Hit.PawnIndex == PawnIndex)
+				{
+					Hit.Generation = Generation;
+					break;
+				}
+			}
+			return;
+		}
+
+		Bits[PawnIndex] = true;
+		HitPawnGenerations[PhaseIndex].Add({ PawnIndex, Generation });
+		return;
+	}
+
+	HitUnregisteredActors[PhaseIndex].Add(Actor);
+}
+
+/**
+ * Clears a phase's hit tracking without freeing memory.
+ */
+void ANeonProjectile::ResetHitsForPhase(EProjectilePhase Phase)
+{
+	const int32 PhaseIndex = static_cast<int32>(Phase);
+	HitPawnBits[PhaseIndex].Reset();
+	HitPawnGenerations[PhaseIndex].Reset();
+	HitUnregisteredActors[PhaseIndex].Reset();
+}
+
+/**
+ * Handles blocking hits (walls, obstacles) from physics sweeps.
+ * Routes to HandleBlockingHit for processing.
  */
 void ANeonProjectile::OnProjectileHit(
 	UPrimitiveComponent* HitComp, 
@@ -163,25 +769,32 @@ void ANeonProjectile::OnProjectileHit(
 	UPrimitiveComponent* OtherComp, 
 	FVector NormalImpulse, 
 	const FHitResult& Hit)
+{
+	HandleBlockingHit(OtherActor, Hit);
+}
+
+/**
+ * Blocking-hit response shared by physics hits and the spatial-hash wall trace.
+ */
+void ANeonProjectile::HandleBlockingHit(AActor* OtherActor, const FHitResult& Hit)
 {
 	// ========================================
 	// Boomerang Wall Hit Logic
 	// ========================================
 	if (bIsBoomerang && BoomerangPhase == EProjectilePhase::Outgoing && Hit.bBlockingHit)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Boomerang hit wall: %s. Forcing Return."), 
-			*OtherActor->GetName());
+		NEON_COMBAT_VERBOSE(TEXT("Boomerang hit wall: %s. Forcing Return."), 
+			*GetNameSafe(OtherActor));
 
 		// Switch to return phase early
 		BoomerangPhase = EProjectilePhase::Returning;
-		HitActorsThisPhase.Empty();
+		ResetHitsForPhase(EProjectilePhase::Returning);
+		RecordPhaseEvent(ENeonCombatEventType::BoomerangPhase);
 
-		// Enable homing back to owner
-		if (ProjectileMovement && BoomerangOwner)
+		// Turn around and home back to owner
+		if (UNeonProjectileSimSubsystem* Sim = GetWorld()->GetSubsystem<UNeonProjectileSimSubsystem>())
 		{
-			ProjectileMovement->bIsHomingProjectile = true;
-			ProjectileMovement->HomingAccelerationMagnitude = 8000.f;
-			ProjectileMovement->HomingTargetComponent = BoomerangOwner->GetRootComponent();
+			Sim->ForceReturnPhase(this);
 		}
 	}
 	// ========================================
@@ -189,8 +802,8 @@ void ANeonProjectile::OnProjectileHit(
 	// ========================================
 	else if (!bIsBoomerang)
 	{
-		// Standard projectiles destroy on any blocking hit
-		Destroy();
+		// Standard projectiles end their flight on any blocking hit
+		ReleaseOrDestroy();
 	}
 }
 
@@ -211,51 +824,77 @@ void ANeonProjectile::OnProjectileOverlap(
 }
 
 /**
- * Applies a Gameplay Effect to a target actor.
- * Handles all the GAS boilerplate for effect application.
+ * Applies a Gameplay Effect to a target.
+ * The context/spec boilerplate is done once per flight in GetFlightEffectSpec.
  */
 void ANeonProjectile::ApplyGameplayEffectToTarget(
-	AActor* TargetActor, 
+	UAbilitySystemComponent* TargetASC, 
 	TSubclassOf<UGameplayEffect> EffectClass)
 {
+	NEON_COMBAT_SCOPE(STAT_NeonProjectileApplyEffect);
+
 	// Validate inputs
-	if (!TargetActor || !EffectClass)
+	if (!TargetASC || !EffectClass)
 	{
 		return;
 	}
 
-	// Get target's Ability System Component
-	UAbilitySystemComponent* TargetASC = 
-		UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
-	
-	// Get source ASC (the player who fired this)
-	UAbilitySystemComponent* SourceASC = nullptr;
-	if (GetOwner())
+	UNeonEffectLibrary::ApplyEffectSpecToTargets(GetFlightEffectSpec(EffectClass), MakeArrayView(&TargetASC, 1));
+}
+
+/**
+ * Returns the flight's spec for an effect class, normally built at launch by BuildFlightEffectSpecs.
+ * It is built here instead if the class was still streaming at launch, or Blueprint changed the effect or damage since.
+ * The source is the player who fired this projectile; without one the spec still works with a plain context.
+ */
+const FGameplayEffectSpecHandle& ANeonProjectile::GetFlightEffectSpec(TSubclassOf<UGameplayEffect> EffectClass)
+{
+	const bool bIsDamageEffect = EffectClass.Get() == DamageEffectClass.Get();
+	FGameplayEffectSpecHandle& FlightSpec = bIsDamageEffect ? FlightDamageSpec : FlightCorruptionSpec;
+
+	const bool bStale = !FlightSpec.IsValid()
+		|| FlightSpec.Data->Def != GetDefault<UGameplayEffect>(EffectClass)
+		|| (bIsDamageEffect && DamageMagnitude > 0.f
+			&& FlightSpec.Data->GetSetByCallerMagnitude(NeonGameplayTags::Data_Damage, false, 0.f) != DamageMagnitude);
+
+	if (bStale)
 	{
-		SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetOwner());
+		AActor* Source = GetOwner();
+		UAbilitySystemComponent* SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Source);
+
+		// Damage value for UNeonDamageExecCalculation
+		FlightSpec = UNeonEffectLibrary::MakeBatchEffectSpec(
+			SourceASC, 
+			Source, 
+			this, 
+			EffectClass, 
+			1.0f, 
+			bIsDamageEffect ? DamageMagnitude : 0.f
+		);
 	}
 
-	// Apply the effect if target has an ASC
-	if (TargetASC)
+	return FlightSpec;
+}
+
+/**
+ * Attacker stats are snapshotted when a spec is built, so building both specs here is what makes a projectile
+ * keep the stats it was thrown with. Only the machine applying effects needs them (not replicas or predicted stand-ins).
+ */
+void ANeonProjectile::BuildFlightEffectSpecs()
+{
+	if (!ShouldApplyEffects() || GetNetMode() == NM_Client)
 	{
-		// Create effect context
-		FGameplayEffectContextHandle EffectContext = TargetASC->MakeEffectContext();
-		EffectContext.AddSourceObject(this);
+		return;
+	}
 
-		// Add instigator if we have a source
-		if (SourceASC)
-		{
-			EffectContext.AddInstigator(GetOwner(), GetOwner());
-		}
+	if (const TSubclassOf<UGameplayEffect> DamageEffect = UNeonAssetPreloadSubsystem::ResolveClass(this, DamageEffectClass))
+	{
+		GetFlightEffectSpec(DamageEffect);
+	}
 
-		// Create and apply the effect spec
-		FGameplayEffectSpecHandle SpecHandle = 
-			TargetASC->MakeOutgoingSpec(EffectClass, 1.0f, EffectContext);
-		
-		if (SpecHandle.IsValid())
-		{
-			TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-		}
+	if (const TSubclassOf<UGameplayEffect> CorruptionEffect = UNeonAssetPreloadSubsystem::ResolveClass(this, CorruptionEffectClass))
+	{
+		GetFlightEffectSpec(CorruptionEffect);
 	}
 }
 
@@ -265,6 +904,8 @@ void ANeonProjectile::ApplyGameplayEffectToTarget(
  */
 void ANeonProjectile::HandleCollisionLogic(AActor* OtherActor)
 {
+	NEON_COMBAT_SCOPE(STAT_NeonProjectileCollision);
+
 	// Ignore invalid targets and self-hits
 	if (!OtherActor || OtherActor == GetOwner())
 	{
@@ -276,14 +917,19 @@ void ANeonProjectile::HandleCollisionLogic(AActor* OtherActor)
 	// ========================================
 	if (!bIsBoomerang)
 	{
-		// Apply damage effect
-		if (DamageEffectClass)
+		OnTargetHit(OtherActor, BoomerangPhase);
+
+		// Apply damage effect on the server (skipped, not sync-loaded, if it hasn't streamed in yet)
+		if (ShouldApplyEffects())
 		{
-			ApplyGameplayEffectToTarget(OtherActor, DamageEffectClass);
+			if (const TSubclassOf<UGameplayEffect> DamageEffect = UNeonAssetPreloadSubsystem::ResolveClass(this, DamageEffectClass))
+			{
+				ApplyGameplayEffectToTarget(UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OtherActor), DamageEffect);
+			}
 		}
 		
-		// Destroy projectile
-		Destroy();
+		// End flight (back to pool, or destroy if not pooled)
+		ReleaseOrDestroy();
 		return;
 	}
 
@@ -291,44 +937,71 @@ void ANeonProjectile::HandleCollisionLogic(AActor* OtherActor)
 	// Boomerang Behavior
 	// ========================================
 
-	// Prevent hitting the same actor twice in one phase
-	if (HitActorsThisPhase.Contains(OtherActor))
+	// Prevent hitting the same actor twice in one phase (one bit test for combat pawns)
+	const int32 PawnIndex = GetCombatPawnIndex(OtherActor);
+	if (HasHitThisPhase(OtherActor, PawnIndex))
 	{
 		return;
 	}
 
-	// Only process actors with Ability System Components
-	UAbilitySystemComponent* TargetASC = 
-		UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OtherActor);
+	// Only process actors with Ability System Components (cached by the registry for combat pawns)
+	UAbilitySystemComponent* TargetASC = PawnIndex != INDEX_NONE
+		? GetWorld()->GetSubsystem<UNeonCombatPawnRegistry>()->GetAbilitySystemComponent(PawnIndex)
+		: UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OtherActor);
 	if (!TargetASC)
 	{
 		return;
 	}
 
 	// Track that we've hit this actor in this phase
-	HitActorsThisPhase.Add(OtherActor);
+	MarkHitThisPhase(OtherActor, PawnIndex);
+
+	// Cosmetics play immediately everywhere; effects are the server's call
+	OnTargetHit(OtherActor, BoomerangPhase);
+	if (!ShouldApplyEffects())
+	{
+		return;
+	}
 
 	// Apply appropriate effect based on current phase
 	if (BoomerangPhase == EProjectilePhase::Outgoing)
 	{
 		// Outgoing: Apply Corruption debuff
-		if (CorruptionEffectClass)
+		if (const TSubclassOf<UGameplayEffect> CorruptionEffect = UNeonAssetPreloadSubsystem::ResolveClass(this, CorruptionEffectClass))
 		{
-			ApplyGameplayEffectToTarget(OtherActor, CorruptionEffectClass);
-			UE_LOG(LogTemp, Warning, 
-				TEXT("Boomerang OUTGOING hit: %s - Applied Corruption!"), 
+			ApplyGameplayEffectToTarget(TargetASC, CorruptionEffect);
+			if (UNeonCombatEventSubsystem* CombatEvents = GetWorld()->GetSubsystem<UNeonCombatEventSubsystem>())
+			{
+				CombatEvents->RecordEvent(ENeonCombatEventType::Corruption, GetOwner(), OtherActor, 0.f, NeonGameplayTags::Status_Corrupted);
+			}
+			NEON_COMBAT_VERBOSE(TEXT("Boomerang OUTGOING hit: %s - Applied Corruption!"), 
 				*OtherActor->GetName());
 		}
 	}
 	else if (BoomerangPhase == EProjectilePhase::Returning)
 	{
 		// Returning: Apply Damage (combo with corruption!)
-		if (DamageEffectClass)
+		if (const TSubclassOf<UGameplayEffect> DamageEffect = UNeonAssetPreloadSubsystem::ResolveClass(this, DamageEffectClass))
 		{
-			ApplyGameplayEffectToTarget(OtherActor, DamageEffectClass);
-			UE_LOG(LogTemp, Warning, 
-				TEXT("Boomerang RETURNING hit: %s - Applied Damage!"), 
+			ApplyGameplayEffectToTarget(TargetASC, DamageEffect);
+			NEON_COMBAT_VERBOSE(TEXT("Boomerang RETURNING hit: %s - Applied Damage!"), 
 				*OtherActor->GetName());
 		}
 	}
+}
+
+/**
+ * Lists the soft effect references so a character's manifest can stream them before the first hit.
+ */
+void ANeonProjectile::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	if (!DamageEffectClass.IsNull())
+	{
+		OutAssets.AddUnique(DamageEffectClass.ToSoftObjectPath());
+	}
+
+	if (!CorruptionEffectClass.IsNull())
+	{
+		OutAssets.AddUnique(CorruptionEffectClass.ToSoftObjectPath());
+	}
 }
\ No newline at end of file
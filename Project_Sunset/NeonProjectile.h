@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
+#include "GameplayPrediction.h"
+#include "Engine/NetSerialization.h"
 #include "NeonProjectile.generated.h"
 
 // Forward declarations to avoid circular dependencies
@@ -10,6 +13,8 @@ class USphereComponent;
 class UProjectileMovementComponent;
 class UStaticMeshComponent;
 class UGameplayEffect;
+class UAbilitySystemComponent;
+enum class ENeonCombatEventType : uint8;
 
 /**
  * Enum defining the two phases of a boomerang projectile's flight path.
@@ -24,9 +29,64 @@ enum class EProjectilePhase : uint8
 	Returning UMETA(DisplayName = "Returning")
 };
 
+/**
+ * How a projectile finds the pawns it hits.
+ */
+UENUM(BlueprintType)
+enum class ENeonProjectileHitDetection : uint8
+{
+	/** Physics overlap events from sweeping the collision sphere (default) */
+	PhysicsOverlap UMETA(DisplayName = "Physics Overlap"),
+	
+	/** Swept-sphere queries against the combat pawn spatial hash; walls use a line trace */
+	SpatialHash UMETA(DisplayName = "Spatial Hash")
+};
+
+/**
+ * Everything a client needs to reproduce a boomerang flight locally.
+ * The outgoing leg is a straight line at the class's InitialSpeed, so position and phase
+ * at any time follow from these values alone.
+ */
+USTRUCT()
+struct FNeonProjectileLaunchState
+{
+	GENERATED_BODY()
+
+	/** Launch location (the outgoing distance is measured from here) */
+	UPROPERTY()
+	FVector_NetQuantize10 Location = FVector::ZeroVector;
+
+	/** Flight direction */
+	UPROPERTY()
+	FVector_NetQuantizeNormal Direction = FVector::ForwardVector;
+
+	/** Server world time the flight started (earlier than the actual spawn when forward predicted) */
+	UPROPERTY()
+	double ServerLaunchTime = 0.0;
+
+	/** Outgoing distance before returning (0 = straight flight) */
+	UPROPERTY()
+	float MaxTravelDistance = 0.f;
+
+	/** FPredictionKey::Current of the ability activation that fired the projectile (0 = not predicted) */
+	UPROPERTY()
+	int16 PredictionKey = 0;
+
+	/** Bumped every launch, so a recycled projectile always replicates as a new flight */
+	UPROPERTY()
+	uint8 LaunchCount = 0;
+
+	/** False while the projectile is parked in the server's pool */
+	UPROPERTY()
+	bool bInFlight = false;
+};
+
 /**
  * Projectile actor that can function as either a standard projectile or a boomerang.
  * 
+ * Movement and phase logic run in UNeonProjectileSimSubsystem (one batched update for all projectiles);
+ * this actor is a view over its simulation slot and handles collision responses and effects.
+ * 
  * Standard Mode:
  * - Flies in a straight line
  * - Applies damage on hit
@@ -37,6 +97,13 @@ enum class EProjectilePhase : uint8
  * - Applies Corruption effect on outgoing flight
  * - Applies Damage effect on return flight
  * - Can hit each enemy once per phase (twice total)
+ * 
+ * Networking (LaunchBoomerang):
+ * - The server replicates FNeonProjectileLaunchState instead of movement; clients simulate the flight
+ *   locally from it, fast-forwarded by the time since launch
+ * - A predicting client flies a local stand-in straight away; when the server's projectile arrives
+ *   with the same prediction key it takes over the stand-in's position and hits
+ * - Only the server applies effects; OnTargetHit plays hit cosmetics on every machine
  */
 UCLASS()
 class PROJECT_SUNSET_API ANeonProjectile : public AActor
@@ -46,9 +113,6 @@ class PROJECT_SUNSET_API ANeonProjectile : public AActor
 public:    
 	ANeonProjectile();
 
-	/** Called every frame to update boomerang return logic */
-	virtual void Tick(float DeltaTime) override;
-
 	// ========================================
 	// Components
 	// ========================================
@@ -57,7 +121,10 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	USphereComponent* CollisionComponent;
 
-	/** Handles projectile movement physics */
+	/** 
+	 * Movement settings (InitialSpeed, MaxSpeed) read by the simulation manager.
+	 * The component itself no longer ticks - UNeonProjectileSimSubsystem moves the projectile.
+	 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UProjectileMovementComponent* ProjectileMovement;
 
@@ -65,17 +132,36 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UStaticMeshComponent* MeshComponent;
 
+	/** 
+	 * How hits against pawns are detected.
+	 * SpatialHash avoids physics overlap events entirely (cheaper in dense fights) with the same phase rules.
+	 * Can be forced for all projectiles with neon.Projectile.ForceSpatialHashHits.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision", Meta = (ExposeOnSpawn = true))
+	ENeonProjectileHitDetection HitDetectionMode = ENeonProjectileHitDetection::PhysicsOverlap;
+
 	// ========================================
 	// Gameplay Effects
 	// ========================================
 	
-	/** Gameplay Effect applied on hit (standard) or on return (boomerang) */
+	/**
+	 * Gameplay Effect applied on hit (standard) or on return (boomerang).
+	 * Soft so the effect isn't loaded with every Blueprint that references the projectile;
+	 * list the projectile in a preload manifest so it's resident before the first hit.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay Effects")
-	TSubclassOf<UGameplayEffect> DamageEffectClass;
+	TSoftClassPtr<UGameplayEffect> DamageEffectClass;
 
 	/** Gameplay Effect applied on outgoing flight (boomerang only) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay Effects")
-	TSubclassOf<UGameplayEffect> CorruptionEffectClass;
+	TSoftClassPtr<UGameplayEffect> CorruptionEffectClass;
+
+	/**
+	 * Base damage passed to DamageEffectClass as the Data.Damage SetByCaller magnitude.
+	 * 0 = don't set it (the effect or the exec calculation decides).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gameplay Effects", Meta = (ExposeOnSpawn = true, ClampMin = "0.0"))
+	float DamageMagnitude = 0.f;
 
 	// ========================================
 	// Boomerang Properties
@@ -101,9 +187,20 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Boomerang")
 	EProjectilePhase BoomerangPhase = EProjectilePhase::Outgoing;
 
-	/** Tracks actors hit during current phase (prevents double-hitting same target) */
-	UPROPERTY(BlueprintReadWrite, Category = "Boomerang")
-	TSet<AActor*> HitActorsThisPhase;
+	/** Homing acceleration toward the owner during the return phase */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boomerang")
+	float ReturnHomingAcceleration = 8000.f;
+
+	/** Distance to the owner at which a returning boomerang is caught */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boomerang")
+	float ReturnCatchRadius = 100.f;
+
+	/**
+	 * Whether an actor was already hit during the current phase.
+	 * Each actor can be hit once per phase (prevents double-hitting same target).
+	 */
+	UFUNCTION(BlueprintPure, Category = "Boomerang")
+	bool WasActorHitThisPhase(AActor* Actor) const;
 
 	/**
 	 * Initializes this projectile as a boomerang.
@@ -115,10 +212,87 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Boomerang")
 	void InitializeBoomerang(AActor* InOwner, float InMaxDistance);
 
+	/**
+	 * Initializes a networked boomerang. Call right after acquiring the projectile, like InitializeBoomerang.
+	 * On the server the launch state replicates; on a client this becomes a predicted stand-in that the
+	 * server's projectile with the same prediction key takes over.
+	 * 
+	 * @param InOwner - Return target
+	 * @param InMaxDistance - Outgoing distance
+	 * @param PredictionKey - Activation prediction key of the firing ability (invalid = not predicted)
+	 * @param ForwardPredictTime - Seconds the flight is advanced at launch (server catching up with a predicting client)
+	 */
+	void LaunchBoomerang(AActor* InOwner, float InMaxDistance, const FPredictionKey& PredictionKey, float ForwardPredictTime = 0.f);
+
+	/** Whether this is a client's predicted stand-in (never applies effects) */
+	bool IsPredictedFake() const { return bIsPredictedFake; }
+
+	/** FPredictionKey::Current of the current flight (0 = not predicted) */
+	int16 GetPredictionKey() const { return LaunchState.PredictionKey; }
+
+	/**
+	 * Called on every machine when the projectile hits a target, for hit cosmetics.
+	 * On clients this fires immediately; the effect itself is only applied by the server.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Projectile")
+	void OnTargetHit(AActor* Target, EProjectilePhase Phase);
+
+	/** A predicted stand-in further than this from the server's flight is snapped to the server's position */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Networking")
+	float ReconcileTolerance = 150.f;
+
+	// ========================================
+	// Pooling Hooks
+	// ========================================
+
+	/**
+	 * Clears all per-flight state so the projectile behaves like a freshly spawned one.
+	 * Resets boomerang mode, phase, owner, hit list and homing settings.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pooling")
+	void ResetProjectile();
+
+	/**
+	 * Brings a pooled projectile back into the world at the given transform.
+	 * Resets flight state, re-enables collision/visibility and re-arms movement at InitialSpeed.
+	 * 
+	 * @param LaunchTransform - Launch location and facing (forward vector = flight direction)
+	 */
+	void ActivateProjectile(const FTransform& LaunchTransform);
+
+	/**
+	 * Parks the projectile: hidden, no collision, no tick, movement stopped.
+	 * Called by the pool on release; the actor stays alive for reuse.
+	 */
+	void DeactivateProjectile();
+
+	/** Whether this projectile is owned by UNeonProjectilePoolSubsystem (released instead of destroyed) */
+	bool IsPooled() const { return bIsPooled; }
+
+	/** Adds the effect classes this projectile applies to a preload list (see UNeonPreloadManifest) */
+	void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
+	/** Current velocity from the simulation manager */
+	UFUNCTION(BlueprintPure, Category = "Projectile")
+	FVector GetSimulatedVelocity() const;
+
 protected:
 	/** Called when the game starts or when spawned */
 	virtual void BeginPlay() override;
 
+	/** Removes the projectile from the simulation manager */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Launch state of the current flight (server -> clients) */
+	UPROPERTY(ReplicatedUsing = OnRep_LaunchState)
+	FNeonProjectileLaunchState LaunchState;
+
+	/** Starts, restarts or ends the local flight of a replicated projectile */
+	UFUNCTION()
+	void OnRep_LaunchState();
+
 	/**
 	 * Handles blocking collisions (walls, obstacles).
 	 * Standard projectiles destroy on hit.
@@ -149,13 +323,31 @@ protected:
 
 private:
 	/**
-	 * Applies a Gameplay Effect to a target actor.
-	 * Handles ASC retrieval and effect context setup.
+	 * Shared blocking-hit response for physics hits and spatial-hash wall traces.
+	 * Standard projectiles end their flight; outgoing boomerangs are forced into the return phase.
+	 * 
+	 * @param OtherActor - The actor that blocked us (may be null for BSP/landscape)
+	 * @param Hit - The blocking hit
+	 */
+	void HandleBlockingHit(AActor* OtherActor, const FHitResult& Hit);
+
+	/**
+	 * Applies a Gameplay Effect to a target through UNeonEffectLibrary,
+	 * reusing the spec built for this flight.
 	 * 
-	 * @param TargetActor - Actor to apply the effect to
+	 * @param TargetASC - Ability System Component of the target
 	 * @param EffectClass - The Gameplay Effect class to apply
 	 */
-	void ApplyGameplayEffectToTarget(AActor* TargetActor, TSubclassOf<UGameplayEffect> EffectClass);
+	void ApplyGameplayEffectToTarget(UAbilitySystemComponent* TargetASC, TSubclassOf<UGameplayEffect> EffectClass);
+
+	/**
+	 * Spec for an effect class, shared by every target this flight hits.
+	 * Source, instigator, level and damage don't change mid-flight, so one spec per class is enough.
+	 */
+	const FGameplayEffectSpecHandle& GetFlightEffectSpec(TSubclassOf<UGameplayEffect> EffectClass);
+
+	/** Builds both flight specs at launch, snapshotting the attacker's stats as they were when it was thrown */
+	void BuildFlightEffectSpecs();
 
 	/**
 	 * Main collision logic handler for both standard and boomerang projectiles.
@@ -164,4 +356,147 @@ private:
 	 * @param OtherActor - The actor that was hit
 	 */
 	void HandleCollisionLogic(AActor* OtherActor);
+
+	/**
+	 * Ends this projectile's flight.
+	 * Pooled projectiles return to the pool, all others are destroyed.
+	 */
+	void ReleaseOrDestroy();
+
+	// ========================================
+	// Simulation Manager Callbacks
+	// ========================================
+
+	/**
+	 * Moves the actor to the transform computed by the simulation manager.
+	 * 
+	 * @param NewLocation - Simulated location
+	 * @param NewRotation - Facing (follows velocity)
+	 * @param bSweep - Sweep the collision component so overlaps and blocking hits fire
+	 * @return Where the actor actually ended up (short of NewLocation if the sweep was blocked)
+	 */
+	FVector ApplySimulatedTransform(const FVector& NewLocation, const FRotator& NewRotation, bool bSweep);
+
+	/**
+	 * Draws the mesh at an interpolated location while the actor (and its collision) stays at the simulated step.
+	 * Used for physics-sweep projectiles, whose collision can't move backwards without re-triggering overlaps.
+	 *
+	 * @param RenderLocation - Interpolated world location for the mesh
+	 */
+	void ApplyRenderLocation(const FVector& RenderLocation);
+
+	/** Called by the simulation manager when an outgoing boomerang reaches MaxTravelDistance */
+	void HandleReturnPhaseStarted();
+
+	/** Called by the simulation manager when a returning boomerang reaches its owner */
+	void HandleReturnedToOwner();
+
+	/** Whether gameplay depends on sweeping the collision component every step */
+	bool RequiresPhysicsSweep() const;
+
+	/** Whether the simulation manager should resolve hits through the combat pawn spatial hash */
+	bool UsesSpatialHashHits() const;
+
+	/** HitDetectionMode after applying the console override */
+	ENeonProjectileHitDetection GetEffectiveHitDetectionMode() const;
+
+	/** Sets up collision responses for the effective hit detection mode */
+	void ApplyHitDetectionMode();
+
+	/** Adds this projectile to the simulation manager */
+	void StartSimulation();
+
+	/**
+	 * Advances a freshly launched boomerang along its deterministic outgoing leg.
+	 * Past MaxTravelDistance it is placed at the turning point in the return phase.
+	 * On the server the skipped stretch is swept for hits; replicas teleport.
+	 */
+	void FastForwardFlight(float ElapsedTime);
+
+	/** Takes over a predicted stand-in's position and hits, then releases the stand-in */
+	void AdoptPredictedFake(ANeonProjectile* Fake);
+
+	/** Ends the local flight of a replicated projectile (the server owns its lifetime) */
+	void EndClientFlight();
+
+	/** Whether hits apply effects here (server, and not a predicted stand-in) */
+	bool ShouldApplyEffects() const;
+
+	/** Marks LaunchState dirty for push-model replication */
+	void MarkLaunchStateDirty();
+
+	/** Records a boomerang phase event in the world's combat event ring */
+	void RecordPhaseEvent(ENeonCombatEventType Type);
+
+	/** Removes this projectile from the simulation manager */
+	void StopSimulation();
+
+	// ========================================
+	// Hit Tracking
+	// ========================================
+
+	/** Registry slot of a combat pawn, or INDEX_NONE for actors outside the combat pawn registry */
+	static int32 GetCombatPawnIndex(const AActor* Actor);
+
+	/** Once-per-phase check (bit test for registered pawns) */
+	bool HasHitThisPhase(const AActor* Actor, int32 PawnIndex) const;
+
+	/** Records a hit for the current phase */
+	void MarkHitThisPhase(AActor* Actor, int32 PawnIndex);
+
+	/** Forgets every hit of a phase (called when a phase starts) */
+	void ResetHitsForPhase(EProjectilePhase Phase);
+
+	/** A registered pawn hit this phase: its registry slot and the slot's generation at the time */
+	struct FPawnHit
+	{
+		int32 PawnIndex = INDEX_NONE;
+		uint32 Generation = 0;
+	};
+
+	/**
+	 * Registry slots hit during each phase, indexed by EProjectilePhase then by combat registry slot.
+	 * Inline storage covers 128 pawns before touching the heap; no object pointers, so nothing for GC to track.
+	 * A clear bit is a definite miss; a set bit is confirmed against HitPawnGenerations, since the slot may have been reused.
+	 */
+	TBitArray<TInlineAllocator<4>> HitPawnBits[2];
+
+	/** Slot generation of every set bit in HitPawnBits, per phase */
+	TArray<FPawnHit, TInlineAllocator<8>> HitPawnGenerations[2];
+
+	/** 
+	 * Hit actors that aren't registered combat pawns (rare - e.g. Blueprint actors with their own ASC).
+	 * Weak so a destroyed actor never leaves a dangling pointer behind.
+	 */
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<2>> HitUnregisteredActors[2];
+
+	/** MeshComponent's relative location as authored (render offsets are applied on top of it) */
+	FVector MeshRestLocation = FVector::ZeroVector;
+
+	/** Shared DamageEffectClass spec for the current flight (reset with the flight) */
+	FGameplayEffectSpecHandle FlightDamageSpec;
+
+	/** Shared CorruptionEffectClass spec for the current flight (reset with the flight) */
+	FGameplayEffectSpecHandle FlightCorruptionSpec;
+
+	/** Slot in UNeonProjectileSimSubsystem, INDEX_NONE while not simulated */
+	int32 SimSlotIndex = INDEX_NONE;
+
+	/** True if this projectile was created by the pool subsystem */
+	bool bIsPooled = false;
+
+	/** True while the projectile is flying (false while parked in the pool) */
+	bool bIsActiveInWorld = true;
+
+	/** True for a client's local stand-in waiting for the server's projectile */
+	bool bIsPredictedFake = false;
+
+	/** LaunchCount of the flight this client last started (replicas only) */
+	uint8 AppliedLaunchCount = 0;
+
+	/** Replaces InitialLifeSpan for pooled projectiles (lifespan would destroy them) */
+	FTimerHandle PooledLifeSpanTimerHandle;
+
+	friend class UNeonProjectilePoolSubsystem;
+	friend class UNeonProjectileSimSubsystem;
 };
\ No newline at end of file
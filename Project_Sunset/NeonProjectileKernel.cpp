@@ -0,0 +1,237 @@
+#include "NeonProjectileKernel.h"
+#include "Math/VectorRegister.h"
+
+/** EProjectilePhase::Returning stored as a byte (kept local so the kernel has no actor dependencies) */
+static constexpr uint8 ReturningPhaseByte = 1;
+
+/** Lanes per vector register */
+static constexpr int32 KernelWidth = 4;
+
+/**
+ * Scalar step - also used for the SIMD tail and as the benchmark baseline.
+ */
+void NeonProjectileKernel::StepScalar(
+	const FNeonProjectileKernelStreams& Streams,
+	int32 BeginIndex,
+	int32 EndIndex,
+	float DeltaTime,
+	TArray<int32>& OutReturnSlots,
+	TArray<int32>& OutCaughtSlots)
+{
+	for (int32 Index = BeginIndex; Index < EndIndex; ++Index)
+	{
+		const bool bIsBoomerang = Streams.BoomerangMask[Index] > 0.5f;
+		const bool bIsReturning = Streams.ReturningMask[Index] > 0.5f;
+
+		float VX = Streams.VelX[Index];
+		float VY = Streams.VelY[Index];
+		float VZ = Streams.VelZ[Index];
+
+		// ========================================
+		// Homing Toward Owner (return phase)
+		// ========================================
+		if (bIsBoomerang && bIsReturning)
+		{
+			const float DX = Streams.TargetX[Index] - Streams.PosX[Index];
+			const float DY = Streams.TargetY[Index] - Streams.PosY[Index];
+			const float DZ = Streams.TargetZ[Index] - Streams.PosZ[Index];
+			const float DistSq = DX * DX + DY * DY + DZ * DZ;
+
+			if (DistSq > UE_SMALL_NUMBER)
+			{
+				const float AccelScale = Streams.HomingAcceleration[Index] * DeltaTime * FMath::InvSqrt(DistSq);
+				VX += DX * AccelScale;
+				VY += DY * AccelScale;
+				VZ += DZ * AccelScale;
+			}
+
+			// Clamp to max speed
+			const float SpeedSq = VX * VX + VY * VY + VZ * VZ;
+			const float MaxSpeed = Streams.MaxSpeed[Index];
+			if (SpeedSq > MaxSpeed * MaxSpeed)
+			{
+				const float SpeedScale = MaxSpeed * FMath::InvSqrt(SpeedSq);
+				VX *= SpeedScale;
+				VY *= SpeedScale;
+				VZ *= SpeedScale;
+			}
+
+			Streams.VelX[Index] = VX;
+			Streams.VelY[Index] = VY;
+			Streams.VelZ[Index] = VZ;
+		}
+
+		// ========================================
+		// Integrate
+		// ========================================
+		const float PX = Streams.PosX[Index] + VX * DeltaTime;
+		const float PY = Streams.PosY[Index] + VY * DeltaTime;
+		const float PZ = Streams.PosZ[Index] + VZ * DeltaTime;
+		Streams.PosX[Index] = PX;
+		Streams.PosY[Index] = PY;
+		Streams.PosZ[Index] = PZ;
+
+		if (!bIsBoomerang)
+		{
+			continue;
+		}
+
+		// ========================================
+		// Phase Transitions
+		// ========================================
+		if (!bIsReturning)
+		{
+			const float SX = PX - Streams.StartX[Index];
+			const float SY = PY - Streams.StartY[Index];
+			const float SZ = PZ - Streams.StartZ[Index];
+
+			if (SX * SX + SY * SY + SZ * SZ >= Streams.MaxDistanceSq[Index])
+			{
+				Streams.Phase[Index] = ReturningPhaseByte;
+				OutReturnSlots.Add(Index);
+			}
+		}
+		else
+		{
+			const float OX = PX - Streams.TargetX[Index];
+			const float OY = PY - Streams.TargetY[Index];
+			const float OZ = PZ - Streams.TargetZ[Index];
+
+			if (OX * OX + OY * OY + OZ * OZ < Streams.CatchRadiusSq[Index])
+			{
+				OutCaughtSlots.Add(Index);
+			}
+		}
+	}
+}
+
+/**
+ * 4-wide step. Both phases are computed for every lane and blended with masks,
+ * so the loop body has no per-lane branches. Only lanes that produced an event
+ * (transition or catch) are touched again in scalar code.
+ */
+void NeonProjectileKernel::StepSimd(
+	const FNeonProjectileKernelStreams& Streams,
+	float DeltaTime,
+	TArray<int32>& OutReturnSlots,
+	TArray<int32>& OutCaughtSlots)
+{
+	const int32 NumVectorized = Streams.Num - (Streams.Num % KernelWidth);
+
+	const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+	const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+	const VectorRegister4Float One = VectorSetFloat1(1.f);
+	const VectorRegister4Float SmallNumber = VectorSetFloat1(UE_SMALL_NUMBER);
+
+	for (int32 Index = 0; Index < NumVectorized; Index += KernelWidth)
+	{
+		// ========================================
+		// Load
+		// ========================================
+		const VectorRegister4Float PX = VectorLoad(Streams.PosX + Index);
+		const VectorRegister4Float PY = VectorLoad(Streams.PosY + Index);
+		const VectorRegister4Float PZ = VectorLoad(Streams.PosZ + Index);
+		const VectorRegister4Float VX = VectorLoad(Streams.VelX + Index);
+		const VectorRegister4Float VY = VectorLoad(Streams.VelY + Index);
+		const VectorRegister4Float VZ = VectorLoad(Streams.VelZ + Index);
+		const VectorRegister4Float TX = VectorLoad(Streams.TargetX + Index);
+		const VectorRegister4Float TY = VectorLoad(Streams.TargetY + Index);
+		const VectorRegister4Float TZ = VectorLoad(Streams.TargetZ + Index);
+
+		const VectorRegister4Float BoomerangMask = VectorCompareGT(VectorLoad(Streams.BoomerangMask + Index), Half);
+		const VectorRegister4Float ReturningMask = VectorCompareGT(VectorLoad(Streams.ReturningMask + Index), Half);
+		const VectorRegister4Float HomingMask = VectorBitwiseAnd(BoomerangMask, ReturningMask);
+
+		// ========================================
+		// Homing Toward Owner
+		// ========================================
+		const VectorRegister4Float DX = VectorSubtract(TX, PX);
+		const VectorRegister4Float DY = VectorSubtract(TY, PY);
+		const VectorRegister4Float DZ = VectorSubtract(TZ, PZ);
+		const VectorRegister4Float DistSq = VectorMultiplyAdd(DX, DX, VectorMultiplyAdd(DY, DY, VectorMultiply(DZ, DZ)));
+
+		// Zero acceleration when already sitting on the owner (avoids normalizing a zero vector)
+		const VectorRegister4Float HasDirection = VectorCompareGT(DistSq, SmallNumber);
+		const VectorRegister4Float InvDist = VectorReciprocalSqrt(VectorMax(DistSq, SmallNumber));
+		const VectorRegister4Float AccelScale = VectorSelect(
+			HasDirection,
+			VectorMultiply(VectorMultiply(VectorLoad(Streams.HomingAcceleration + Index), Dt), InvDist),
+			VectorZeroFloat()
+		);
+
+		VectorRegister4Float HX = VectorMultiplyAdd(DX, AccelScale, VX);
+		VectorRegister4Float HY = VectorMultiplyAdd(DY, AccelScale, VY);
+		VectorRegister4Float HZ = VectorMultiplyAdd(DZ, AccelScale, VZ);
+
+		// Clamp to max speed: scale = min(1, MaxSpeed / |V|)
+		const VectorRegister4Float SpeedSq = VectorMultiplyAdd(HX, HX, VectorMultiplyAdd(HY, HY, VectorMultiply(HZ, HZ)));
+		const VectorRegister4Float SpeedScale = VectorMin(
+			One,
+			VectorMultiply(VectorLoad(Streams.MaxSpeed + Index), VectorReciprocalSqrt(VectorMax(SpeedSq, SmallNumber)))
+		);
+		HX = VectorMultiply(HX, SpeedScale);
+		HY = VectorMultiply(HY, SpeedScale);
+		HZ = VectorMultiply(HZ, SpeedScale);
+
+		// Only returning boomerangs take the homed velocity
+		const VectorRegister4Float NewVX = VectorSelect(HomingMask, HX, VX);
+		const VectorRegister4Float NewVY = VectorSelect(HomingMask, HY, VY);
+		const VectorRegister4Float NewVZ = VectorSelect(HomingMask, HZ, VZ);
+
+		// ========================================
+		// Integrate
+		// ========================================
+		const VectorRegister4Float NewPX = VectorMultiplyAdd(NewVX, Dt, PX);
+		const VectorRegister4Float NewPY = VectorMultiplyAdd(NewVY, Dt, PY);
+		const VectorRegister4Float NewPZ = VectorMultiplyAdd(NewVZ, Dt, PZ);
+
+		VectorStore(NewVX, Streams.VelX + Index);
+		VectorStore(NewVY, Streams.VelY + Index);
+		VectorStore(NewVZ, Streams.VelZ + Index);
+		VectorStore(NewPX, Streams.PosX + Index);
+		VectorStore(NewPY, Streams.PosY + Index);
+		VectorStore(NewPZ, Streams.PosZ + Index);
+
+		// ========================================
+		// Phase Transitions
+		// ========================================
+
+		// Outgoing: traveled at least MaxTravelDistance from the launch point
+		const VectorRegister4Float SX = VectorSubtract(NewPX, VectorLoad(Streams.StartX + Index));
+		const VectorRegister4Float SY = VectorSubtract(NewPY, VectorLoad(Streams.StartY + Index));
+		const VectorRegister4Float SZ = VectorSubtract(NewPZ, VectorLoad(Streams.StartZ + Index));
+		const VectorRegister4Float TraveledSq = VectorMultiplyAdd(SX, SX, VectorMultiplyAdd(SY, SY, VectorMultiply(SZ, SZ)));
+		const VectorRegister4Float ReachedMax = VectorCompareGE(TraveledSq, VectorLoad(Streams.MaxDistanceSq + Index));
+
+		// Returning: inside the catch radius around the owner
+		const VectorRegister4Float OX = VectorSubtract(NewPX, TX);
+		const VectorRegister4Float OY = VectorSubtract(NewPY, TY);
+		const VectorRegister4Float OZ = VectorSubtract(NewPZ, TZ);
+		const VectorRegister4Float OwnerDistSq = VectorMultiplyAdd(OX, OX, VectorMultiplyAdd(OY, OY, VectorMultiply(OZ, OZ)));
+		const VectorRegister4Float InCatchRadius = VectorCompareLT(OwnerDistSq, VectorLoad(Streams.CatchRadiusSq + Index));
+
+		// Outgoing lanes take ReachedMax, returning lanes take InCatchRadius; non-boomerangs take nothing
+		const uint32 ReturnBits = VectorMaskBits(VectorBitwiseAnd(BoomerangMask, VectorSelect(ReturningMask, VectorZeroFloat(), ReachedMax)));
+		const uint32 CaughtBits = VectorMaskBits(VectorBitwiseAnd(HomingMask, InCatchRadius));
+
+		// Rare - only lanes with events leave vector code
+		if ((ReturnBits | CaughtBits) != 0)
+		{
+			for (int32 Lane = 0; Lane < KernelWidth; ++Lane)
+			{
+				if (ReturnBits & (1u << Lane))
+				{
+					Streams.Phase[Index + Lane] = ReturningPhaseByte;
+					OutReturnSlots.Add(Index + Lane);
+				}
+				if (CaughtBits & (1u << Lane))
+				{
+					OutCaughtSlots.Add(Index + Lane);
+				}
+			}
+		}
+	}
+
+	// Leftover slots that don't fill a register
+	StepScalar(Streams, NumVectorized, Streams.Num, DeltaTime, OutReturnSlots, OutCaughtSlots);
+}
\ No newline at end of file
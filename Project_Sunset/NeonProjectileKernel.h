@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Raw views over the projectile simulation streams consumed by the step kernels.
+ * All arrays hold Num entries; slot i of every array belongs to the same projectile.
+ *
+ * Target/mask streams are filled by the caller before each step (a cheap gather pass),
+ * so the kernels themselves never follow owner indices and can run 4 lanes at a time.
+ */
+struct FNeonProjectileKernelStreams
+{
+	/** Number of slots */
+	int32 Num = 0;
+
+	// ========================================
+	// Read/Write
+	// ========================================
+
+	/** Position (updated in place) */
+	float* PosX = nullptr;
+	float* PosY = nullptr;
+	float* PosZ = nullptr;
+
+	/** Velocity (updated in place by homing) */
+	float* VelX = nullptr;
+	float* VelY = nullptr;
+	float* VelZ = nullptr;
+
+	/** Phase byte per slot (Outgoing -> Returning is written by the kernel) */
+	uint8* Phase = nullptr;
+
+	// ========================================
+	// Read Only
+	// ========================================
+
+	/** Launch position */
+	const float* StartX = nullptr;
+	const float* StartY = nullptr;
+	const float* StartZ = nullptr;
+
+	/** Squared outgoing distance before turning around */
+	const float* MaxDistanceSq = nullptr;
+
+	/** Speed cap applied after homing */
+	const float* MaxSpeed = nullptr;
+
+	/** Homing acceleration toward the owner while returning */
+	const float* HomingAcceleration = nullptr;
+
+	/** Squared catch radius around the owner */
+	const float* CatchRadiusSq = nullptr;
+
+	/** Owner position gathered per slot */
+	const float* TargetX = nullptr;
+	const float* TargetY = nullptr;
+	const float* TargetZ = nullptr;
+
+	/** 1.0 for boomerangs with a live owner, 0.0 for everything else (straight flight only) */
+	const float* BoomerangMask = nullptr;
+
+	/** 1.0 while the slot is in the return phase, 0.0 while outgoing */
+	const float* ReturningMask = nullptr;
+};
+
+/**
+ * Boomerang phase/homing kernels.
+ *
+ * One pass per step does, for every slot:
+ * - Homing acceleration toward the owner and speed clamping (returning boomerangs only)
+ * - Integration (position += velocity * DeltaTime)
+ * - Outgoing -> Returning transition once |Position - Start|^2 >= MaxDistance^2
+ * - Catch detection once |Position - Owner|^2 < CatchRadius^2
+ *
+ * Every distance test is a squared-distance comparison; the only square root is the
+ * reciprocal one needed to normalize the homing direction.
+ */
+namespace NeonProjectileKernel
+{
+	/**
+	 * Reference implementation, one slot at a time.
+	 *
+	 * @param Streams - Simulation streams
+	 * @param BeginIndex - First slot to process
+	 * @param EndIndex - One past the last slot to process
+	 * @param DeltaTime - Step length in seconds
+	 * @param OutReturnSlots - Slots that switched to the return phase this step (appended)
+	 * @param OutCaughtSlots - Slots that reached their owner this step (appended)
+	 */
+	PROJECT_SUNSET_API void StepScalar(
+		const FNeonProjectileKernelStreams& Streams,
+		int32 BeginIndex,
+		int32 EndIndex,
+		float DeltaTime,
+		TArray<int32>& OutReturnSlots,
+		TArray<int32>& OutCaughtSlots
+	);
+
+	/**
+	 * Vectorized implementation processing 4 slots per iteration (SSE/NEON via VectorRegister4Float).
+	 * The tail that doesn't fill a full register is handled by StepScalar.
+	 * Produces the same results as StepScalar up to floating point rounding.
+	 */
+	PROJECT_SUNSET_API void StepSimd(
+		const FNeonProjectileKernelStreams& Streams,
+		float DeltaTime,
+		TArray<int32>& OutReturnSlots,
+		TArray<int32>& OutCaughtSlots
+	);
+}
\ No newline at end of file
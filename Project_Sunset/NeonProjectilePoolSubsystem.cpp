@@ -0,0 +1,216 @@
+#include "NeonProjectilePoolSubsystem.h"
+#include "NeonProjectile.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+/**
+ * Fills the pool for a class until it holds at least Count inactive projectiles.
+ */
+void UNeonProjectilePoolSubsystem::PrewarmPool(TSubclassOf<ANeonProjectile> ProjectileClass, int32 Count)
+{
+	if (!ProjectileClass || Count <= 0)
+	{
+		return;
+	}
+
+	FNeonProjectilePoolBucket& Bucket = Pools.FindOrAdd(ProjectileClass.Get());
+	Bucket.FreeProjectiles.Reserve(Count);
+
+	while (Bucket.FreeProjectiles.Num() < Count)
+	{
+		ANeonProjectile* Projectile = SpawnPooledProjectile(ProjectileClass);
+		if (!Projectile)
+		{
+			// World refused the spawn (tearing down) - stop trying
+			break;
+		}
+
+		Bucket.FreeProjectiles.Add(Projectile);
+	}
+}
+
+/**
+ * Hands out an inactive projectile (or grows the pool by one) and launches it.
+ */
+ANeonProjectile* UNeonProjectilePoolSubsystem::AcquireProjectile(
+	TSubclassOf<ANeonProjectile> ProjectileClass,
+	const FTransform& SpawnTransform,
+	AActor* InOwner,
+	APawn* InInstigator)
+{
+	if (!ProjectileClass)
+	{
+		return nullptr;
+	}
+
+	ANeonProjectile* Projectile = nullptr;
+
+	// ========================================
+	// Reuse an inactive projectile if we have one
+	// ========================================
+	if (FNeonProjectilePoolBucket* Bucket = Pools.Find(ProjectileClass.Get()))
+	{
+		while (!Projectile && Bucket->FreeProjectiles.Num() > 0)
+		{
+			ANeonProjectile* Candidate = Bucket->FreeProjectiles.Pop(EAllowShrinking::No);
+
+			// Skip anything destroyed behind our back (e.g. by a level streaming out)
+			if (IsValid(Candidate))
+			{
+				Projectile = Candidate;
+			}
+		}
+	}
+
+	// ========================================
+	// Pool empty - grow it
+	// ========================================
+	if (!Projectile)
+	{
+		Projectile = SpawnPooledProjectile(ProjectileClass);
+		if (!Projectile)
+		{
+			return nullptr;
+		}
+	}
+
+	Projectile->SetOwner(InOwner);
+	Projectile->SetInstigator(InInstigator);
+	Projectile->ActivateProjectile(SpawnTransform);
+
+	return Projectile;
+}
+
+/**
+ * Returns a projectile to its class pool.
+ * Safe to call from inside the projectile's own collision callbacks.
+ */
+void UNeonProjectilePoolSubsystem::ReleaseProjectile(ANeonProjectile* Projectile)
+{
+	if (!IsValid(Projectile))
+	{
+		return;
+	}
+
+	// Projectiles spawned outside the pool keep their old spawn/destroy lifecycle
+	if (!Projectile->bIsPooled)
+	{
+		Projectile->Destroy();
+		return;
+	}
+
+	// Guard against double release (e.g. hit + lifespan expiring in the same frame)
+	if (!Projectile->bIsActiveInWorld)
+	{
+		return;
+	}
+
+	Projectile->DeactivateProjectile();
+	Projectile->SetOwner(nullptr);
+	Projectile->SetInstigator(nullptr);
+
+	Pools.FindOrAdd(Projectile->GetClass()).FreeProjectiles.Add(Projectile);
+}
+
+// ========================================
+// Client Prediction
+// ========================================
+
+/**
+ * A newer stand-in under the same key replaces the old one.
+ */
+void UNeonProjectilePoolSubsystem::RegisterPredictedProjectile(ANeonProjectile* Projectile)
+{
+	if (!Projectile)
+	{
+		return;
+	}
+
+	PredictedProjectiles.Add(MakeTuple(TObjectKey<APawn>(Projectile->GetInstigator()), Projectile->GetPredictionKey()), Projectile);
+}
+
+/**
+ * Only removes the entry if it still points at this projectile.
+ */
+void UNeonProjectilePoolSubsystem::UnregisterPredictedProjectile(ANeonProjectile* Projectile)
+{
+	const TPair<TObjectKey<APawn>, int16> Key(TObjectKey<APawn>(Projectile->GetInstigator()), Projectile->GetPredictionKey());
+	if (const TWeakObjectPtr<ANeonProjectile>* Existing = PredictedProjectiles.Find(Key); Existing && Existing->Get() == Projectile)
+	{
+		PredictedProjectiles.Remove(Key);
+	}
+}
+
+/**
+ * Called when the server's projectile replicates with a prediction key.
+ */
+ANeonProjectile* UNeonProjectilePoolSubsystem::TakePredictedProjectile(const APawn* InInstigator, int16 PredictionKey)
+{
+	TWeakObjectPtr<ANeonProjectile> Projectile;
+	PredictedProjectiles.RemoveAndCopyValue(MakeTuple(TObjectKey<APawn>(InInstigator), PredictionKey), Projectile);
+	return Projectile.Get();
+}
+
+/**
+ * Counts inactive projectiles available for a class.
+ */
+int32 UNeonProjectilePoolSubsystem::GetNumFreeProjectiles(TSubclassOf<ANeonProjectile> ProjectileClass) const
+{
+	const FNeonProjectilePoolBucket* Bucket = ProjectileClass ? Pools.Find(ProjectileClass.Get()) : nullptr;
+	return Bucket ? Bucket->FreeProjectiles.Num() : 0;
+}
+
+/**
+ * Drops all references. The actors themselves are cleaned up with the world.
+ */
+void UNeonProjectilePoolSubsystem::Deinitialize()
+{
+	Pools.Empty();
+	PredictedProjectiles.Empty();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds fire projectiles.
+ */
+bool UNeonProjectilePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * Spawns a projectile flagged as pool-owned and immediately parks it.
+ */
+ANeonProjectile* UNeonProjectilePoolSubsystem::SpawnPooledProjectile(TSubclassOf<ANeonProjectile> ProjectileClass)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->bIsTearingDown)
+	{
+		return nullptr;
+	}
+
+	// Deferred so collision is off before the first overlap update runs in FinishSpawning
+	ANeonProjectile* Projectile = World->SpawnActorDeferred<ANeonProjectile>(
+		ProjectileClass,
+		FTransform::Identity,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
+
+	if (!Projectile)
+	{
+		return nullptr;
+	}
+
+	Projectile->bIsPooled = true;
+	Projectile->bIsActiveInWorld = true;
+	Projectile->SetActorEnableCollision(false);
+	Projectile->FinishSpawning(FTransform::Identity);
+
+	// Parks the projectile: hidden, no collision, no movement, no lifespan
+	Projectile->DeactivateProjectile();
+
+	return Projectile;
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonProjectilePoolSubsystem.generated.h"
+
+// Forward declarations
+class ANeonProjectile;
+class APawn;
+
+/**
+ * Free list of deactivated projectiles for a single projectile class.
+ * Wrapped in a struct so the pool map can be a UPROPERTY (keeps pooled actors visible to GC).
+ */
+USTRUCT()
+struct FNeonProjectilePoolBucket
+{
+	GENERATED_BODY()
+
+	/** Inactive projectiles waiting to be handed out again */
+	UPROPERTY()
+	TArray<ANeonProjectile*> FreeProjectiles;
+};
+
+/**
+ * World subsystem that recycles ANeonProjectile actors instead of spawning and destroying one per shot.
+ *
+ * Usage:
+ * - PrewarmPool() during level start / encounter setup to allocate projectiles up front
+ * - AcquireProjectile() instead of SpawnActor when firing
+ * - Projectiles return themselves via ReleaseProjectile() when they would normally Destroy()
+ *
+ * Once warmed, a steady-state fight performs no projectile spawns and creates no projectile garbage.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Spawns projectiles up front so later shots never hit SpawnActor.
+	 *
+	 * @param ProjectileClass - Class to pre-allocate (Blueprint children are pooled separately)
+	 * @param Count - Number of inactive projectiles the pool should hold after this call
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	void PrewarmPool(TSubclassOf<ANeonProjectile> ProjectileClass, int32 Count);
+
+	/**
+	 * Takes a projectile out of the pool (spawning one only if the pool is empty) and launches it.
+	 * Call InitializeBoomerang afterwards for boomerang behavior, exactly like a freshly spawned projectile.
+	 *
+	 * @param ProjectileClass - Class of projectile to fire
+	 * @param SpawnTransform - Launch location and facing
+	 * @param InOwner - Owner of the projectile (ignored by collision, used as effect instigator)
+	 * @param InInstigator - Pawn responsible for the shot
+	 * @return The activated projectile, or nullptr if the world is tearing down
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	ANeonProjectile* AcquireProjectile(
+		TSubclassOf<ANeonProjectile> ProjectileClass,
+		const FTransform& SpawnTransform,
+		AActor* InOwner,
+		APawn* InInstigator
+	);
+
+	/**
+	 * Deactivates a projectile and puts it back in its class pool.
+	 * Projectiles that were not created by the pool are destroyed instead.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Projectile Pool")
+	void ReleaseProjectile(ANeonProjectile* Projectile);
+
+	/** Remembers a client's predicted stand-in under its instigator and prediction key */
+	void RegisterPredictedProjectile(ANeonProjectile* Projectile);
+
+	/** Forgets a predicted stand-in (its flight ended before the server's projectile arrived) */
+	void UnregisterPredictedProjectile(ANeonProjectile* Projectile);
+
+	/**
+	 * Removes and returns the predicted stand-in for a prediction key.
+	 *
+	 * @return The stand-in, or nullptr if there is none (already finished, or fired by another player)
+	 */
+	ANeonProjectile* TakePredictedProjectile(const APawn* InInstigator, int16 PredictionKey);
+
+	/** Number of inactive projectiles currently held for a class (debugging / tuning pre-warm counts) */
+	UFUNCTION(BlueprintPure, Category = "Projectile Pool")
+	int32 GetNumFreeProjectiles(TSubclassOf<ANeonProjectile> ProjectileClass) const;
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Pools only exist in game worlds (not editor preview worlds) */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/**
+	 * Spawns a new projectile owned by the pool in its inactive state.
+	 * Uses deferred spawning so the projectile never overlaps anything at the spawn point.
+	 */
+	ANeonProjectile* SpawnPooledProjectile(TSubclassOf<ANeonProjectile> ProjectileClass);
+
+	/** Inactive projectiles keyed by their exact class */
+	UPROPERTY()
+	TMap<UClass*, FNeonProjectilePoolBucket> Pools;
+
+	/** Client-side predicted stand-ins by (instigator, prediction key); one projectile per ability activation */
+	TMap<TPair<TObjectKey<APawn>, int16>, TWeakObjectPtr<ANeonProjectile>> PredictedProjectiles;
+};
\ No newline at end of file
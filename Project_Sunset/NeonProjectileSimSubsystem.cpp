@@ -0,0 +1,908 @@
+#include "NeonProjectileSimSubsystem.h"
+#include "NeonProjectile.h"
+#include "NeonProjectileKernel.h"
+#include "NeonCombatPawnRegistry.h"
+#include "PlayerCharacter.h"
+#include "NeonCombatStats.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Engine/World.h"
+
+/** Projectiles not rendered recently still get their transform refreshed once every this many frames */
+static constexpr uint32 HiddenWriteBackInterval = 8;
+
+/** How long after its last render a projectile still counts as visible */
+static constexpr float VisibilityTolerance = 0.2f;
+
+static TAutoConsoleVariable<bool> CVarNeonProjectileSimdKernel(
+	TEXT("neon.Projectile.SimdKernel"),
+	true,
+	TEXT("Use the 4-wide SIMD kernel for the batched projectile update (false = scalar reference kernel)."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarNeonProjectileFixedStepHz(
+	TEXT("neon.Projectile.FixedStepHz"),
+	60,
+	TEXT("Projectile simulation steps per second (rendering interpolates between steps). 0 = one variable-length step per frame."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarNeonProjectileMaxSubSteps(
+	TEXT("neon.Projectile.MaxSubSteps"),
+	8,
+	TEXT("Most fixed steps run in one frame. Time beyond that is dropped (projectiles slow down through a hitch instead of stalling the frame)."),
+	ECVF_Default
+);
+
+// ========================================
+// FNeonProjectileSimData
+// ========================================
+
+/**
+ * Appends one slot to every stream.
+ */
+int32 FNeonProjectileSimData::AddSlot()
+{
+	const int32 SlotIndex = PosX.Num();
+
+	PosX.Add(0.f); PosY.Add(0.f); PosZ.Add(0.f);
+	PrevX.Add(0.f); PrevY.Add(0.f); PrevZ.Add(0.f);
+	VelX.Add(0.f); VelY.Add(0.f); VelZ.Add(0.f);
+	StartX.Add(0.f); StartY.Add(0.f); StartZ.Add(0.f);
+	MaxDistanceSq.Add(0.f);
+	MaxSpeed.Add(0.f);
+	HomingAcceleration.Add(0.f);
+	CatchRadiusSq.Add(0.f);
+	CollisionRadius.Add(0.f);
+	Phase.Add(0);
+	Flags.Add(0);
+	OwnerIndex.Add(INDEX_NONE);
+
+	return SlotIndex;
+}
+
+/**
+ * Removes a slot from every stream, keeping them packed.
+ */
+void FNeonProjectileSimData::RemoveSlotAtSwap(int32 SlotIndex)
+{
+	PosX.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	PosY.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	PosZ.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	PrevX.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	PrevY.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	PrevZ.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	VelX.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	VelY.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	VelZ.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	StartX.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	StartY.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	StartZ.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	MaxDistanceSq.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	MaxSpeed.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	HomingAcceleration.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	CatchRadiusSq.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	CollisionRadius.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	Phase.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	Flags.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+	OwnerIndex.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+}
+
+/**
+ * Empties every stream without freeing memory.
+ */
+void FNeonProjectileSimData::Reset()
+{
+	PosX.Reset(); PosY.Reset(); PosZ.Reset();
+	PrevX.Reset(); PrevY.Reset(); PrevZ.Reset();
+	VelX.Reset(); VelY.Reset(); VelZ.Reset();
+	StartX.Reset(); StartY.Reset(); StartZ.Reset();
+	MaxDistanceSq.Reset();
+	MaxSpeed.Reset();
+	HomingAcceleration.Reset();
+	CatchRadiusSq.Reset();
+	CollisionRadius.Reset();
+	Phase.Reset();
+	Flags.Reset();
+	OwnerIndex.Reset();
+}
+
+// ========================================
+// Slot Management
+// ========================================
+
+/**
+ * Creates a slot from the projectile's current transform and movement settings.
+ * Launch velocity is forward * InitialSpeed, matching what UProjectileMovementComponent used to do.
+ */
+int32 UNeonProjectileSimSubsystem::RegisterProjectile(ANeonProjectile* Projectile)
+{
+	if (!Projectile)
+	{
+		return INDEX_NONE;
+	}
+
+	// Already simulated - just refresh boomerang settings
+	if (Projectile->SimSlotIndex != INDEX_NONE)
+	{
+		SyncBoomerangState(Projectile);
+		return Projectile->SimSlotIndex;
+	}
+
+	const int32 SlotIndex = SimData.AddSlot();
+	SlotViews.Add(Projectile);
+	Projectile->SimSlotIndex = SlotIndex;
+
+	// ========================================
+	// Kinematics
+	// ========================================
+	const FVector Location = Projectile->GetActorLocation();
+	SimData.PosX[SlotIndex] = Location.X;
+	SimData.PosY[SlotIndex] = Location.Y;
+	SimData.PosZ[SlotIndex] = Location.Z;
+	SimData.PrevX[SlotIndex] = Location.X;
+	SimData.PrevY[SlotIndex] = Location.Y;
+	SimData.PrevZ[SlotIndex] = Location.Z;
+
+	float InitialSpeed = 2000.f;
+	float MaxSpeed = 2000.f;
+	if (Projectile->ProjectileMovement)
+	{
+		InitialSpeed = Projectile->ProjectileMovement->InitialSpeed;
+		MaxSpeed = Projectile->ProjectileMovement->MaxSpeed;
+	}
+
+	const FVector Velocity = Projectile->GetActorForwardVector() * InitialSpeed;
+	SimData.VelX[SlotIndex] = Velocity.X;
+	SimData.VelY[SlotIndex] = Velocity.Y;
+	SimData.VelZ[SlotIndex] = Velocity.Z;
+
+	// MaxSpeed of 0 means "unlimited" on the movement component
+	SimData.MaxSpeed[SlotIndex] = MaxSpeed > 0.f ? MaxSpeed : UE_BIG_NUMBER;
+
+	SyncBoomerangState(Projectile);
+
+	return SlotIndex;
+}
+
+/**
+ * Removes a projectile's slot. During the update the slot is only marked dead,
+ * because the update loops are still indexing into the arrays.
+ */
+void UNeonProjectileSimSubsystem::UnregisterProjectile(ANeonProjectile* Projectile)
+{
+	if (!Projectile || Projectile->SimSlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 SlotIndex = Projectile->SimSlotIndex;
+	Projectile->SimSlotIndex = INDEX_NONE;
+
+	if (!SlotViews.IsValidIndex(SlotIndex) || SlotViews[SlotIndex] != Projectile)
+	{
+		return;
+	}
+
+	if (bIsUpdating)
+	{
+		// Removed in CompactDeadSlots once the update is done
+		SlotViews[SlotIndex] = nullptr;
+		return;
+	}
+
+	RemoveSlot(SlotIndex);
+}
+
+/**
+ * Mirrors the projectile's boomerang properties into its slot.
+ */
+void UNeonProjectileSimSubsystem::SyncBoomerangState(const ANeonProjectile* Projectile)
+{
+	if (!Projectile || Projectile->SimSlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 SlotIndex = Projectile->SimSlotIndex;
+
+	SimData.StartX[SlotIndex] = Projectile->BoomerangStartLocation.X;
+	SimData.StartY[SlotIndex] = Projectile->BoomerangStartLocation.Y;
+	SimData.StartZ[SlotIndex] = Projectile->BoomerangStartLocation.Z;
+	SimData.MaxDistanceSq[SlotIndex] = FMath::Square(Projectile->MaxTravelDistance);
+	SimData.HomingAcceleration[SlotIndex] = Projectile->ReturnHomingAcceleration;
+	SimData.CatchRadiusSq[SlotIndex] = FMath::Square(Projectile->ReturnCatchRadius);
+	SimData.Phase[SlotIndex] = static_cast<uint8>(Projectile->BoomerangPhase);
+	SimData.CollisionRadius[SlotIndex] = Projectile->CollisionComponent 
+		? Projectile->CollisionComponent->GetScaledSphereRadius() 
+		: 0.f;
+
+	uint8 SlotFlags = 0;
+	if (Projectile->bIsBoomerang && Projectile->BoomerangOwner)
+	{
+		SlotFlags |= NeonSim_Boomerang;
+	}
+	if (Projectile->RequiresPhysicsSweep())
+	{
+		SlotFlags |= NeonSim_PhysicsSweep;
+	}
+	if (Projectile->UsesSpatialHashHits())
+	{
+		SlotFlags |= NeonSim_SpatialHashHits;
+	}
+	SimData.Flags[SlotIndex] = SlotFlags;
+
+	// Swap owner reference if the return target changed
+	AActor* NewOwner = (SlotFlags & NeonSim_Boomerang) ? Projectile->BoomerangOwner : nullptr;
+	const int32 OldOwnerIdx = SimData.OwnerIndex[SlotIndex];
+	const bool bSameOwner = OldOwnerIdx != INDEX_NONE
+		? Owners[OldOwnerIdx].Get() == NewOwner
+		: NewOwner == nullptr;
+
+	if (!bSameOwner)
+	{
+		ReleaseOwnerIndex(OldOwnerIdx);
+		SimData.OwnerIndex[SlotIndex] = AcquireOwnerIndex(NewOwner);
+	}
+}
+
+/**
+ * Early return (wall hit). Turns the velocity toward the owner so the projectile
+ * doesn't grind against the wall while homing slowly turns it around.
+ */
+void UNeonProjectileSimSubsystem::ForceReturnPhase(const ANeonProjectile* Projectile)
+{
+	if (!Projectile || Projectile->SimSlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 SlotIndex = Projectile->SimSlotIndex;
+	SimData.Phase[SlotIndex] = static_cast<uint8>(EProjectilePhase::Returning);
+
+	const int32 OwnerIdx = SimData.OwnerIndex[SlotIndex];
+	AActor* Owner = OwnerIdx != INDEX_NONE ? Owners[OwnerIdx].Get() : nullptr;
+	if (!Owner)
+	{
+		return;
+	}
+
+	const FVector Position(SimData.PosX[SlotIndex], SimData.PosY[SlotIndex], SimData.PosZ[SlotIndex]);
+	const FVector Velocity(SimData.VelX[SlotIndex], SimData.VelY[SlotIndex], SimData.VelZ[SlotIndex]);
+	const FVector NewVelocity = (Owner->GetActorLocation() - Position).GetSafeNormal() * Velocity.Size();
+
+	SimData.VelX[SlotIndex] = NewVelocity.X;
+	SimData.VelY[SlotIndex] = NewVelocity.Y;
+	SimData.VelZ[SlotIndex] = NewVelocity.Z;
+}
+
+/**
+ * Overwrites a slot's kinematics. The next step sweeps from the new position, and rendering doesn't streak from the old one.
+ */
+void UNeonProjectileSimSubsystem::TeleportProjectile(const ANeonProjectile* Projectile, const FVector& Location, const FVector& Velocity)
+{
+	if (!Projectile || Projectile->SimSlotIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 SlotIndex = Projectile->SimSlotIndex;
+	SimData.PosX[SlotIndex] = Location.X;
+	SimData.PosY[SlotIndex] = Location.Y;
+	SimData.PosZ[SlotIndex] = Location.Z;
+	SimData.PrevX[SlotIndex] = Location.X;
+	SimData.PrevY[SlotIndex] = Location.Y;
+	SimData.PrevZ[SlotIndex] = Location.Z;
+	SimData.VelX[SlotIndex] = Velocity.X;
+	SimData.VelY[SlotIndex] = Velocity.Y;
+	SimData.VelZ[SlotIndex] = Velocity.Z;
+}
+
+/**
+ * The segment is treated as one long step (Prev = current position, Pos = Location), so both hit modes see the same
+ * swept path a step would give them. Slot removal is deferred while hit callbacks run, as during the update.
+ */
+FVector UNeonProjectileSimSubsystem::SweepProjectile(ANeonProjectile* Projectile, const FVector& Location, const FVector& Velocity)
+{
+	if (!Projectile || Projectile->SimSlotIndex == INDEX_NONE)
+	{
+		return Location;
+	}
+
+	const int32 SlotIndex = Projectile->SimSlotIndex;
+	SimData.PrevX[SlotIndex] = SimData.PosX[SlotIndex];
+	SimData.PrevY[SlotIndex] = SimData.PosY[SlotIndex];
+	SimData.PrevZ[SlotIndex] = SimData.PosZ[SlotIndex];
+	SimData.PosX[SlotIndex] = Location.X;
+	SimData.PosY[SlotIndex] = Location.Y;
+	SimData.PosZ[SlotIndex] = Location.Z;
+	SimData.VelX[SlotIndex] = Velocity.X;
+	SimData.VelY[SlotIndex] = Velocity.Y;
+	SimData.VelZ[SlotIndex] = Velocity.Z;
+
+	const bool bWasUpdating = bIsUpdating;
+	bIsUpdating = true;
+
+	if ((SimData.Flags[SlotIndex] & NeonSim_SpatialHashHits) != 0)
+	{
+		if (UNeonCombatPawnRegistry* Registry = GetWorld()->GetSubsystem<UNeonCombatPawnRegistry>())
+		{
+			Registry->RefreshSpatialHash();
+			ResolveSpatialHashSlot(SlotIndex, *Registry);
+		}
+	}
+	else if ((SimData.Flags[SlotIndex] & NeonSim_PhysicsSweep) != 0)
+	{
+		SweepPhysicsSlot(SlotIndex);
+	}
+
+	FVector EndLocation = Location;
+	if (SlotViews[SlotIndex] == Projectile)
+	{
+		EndLocation = FVector(SimData.PosX[SlotIndex], SimData.PosY[SlotIndex], SimData.PosZ[SlotIndex]);
+
+		// Render from the end of the segment, not streaking along it
+		SimData.PrevX[SlotIndex] = EndLocation.X;
+		SimData.PrevY[SlotIndex] = EndLocation.Y;
+		SimData.PrevZ[SlotIndex] = EndLocation.Z;
+	}
+
+	bIsUpdating = bWasUpdating;
+	if (!bIsUpdating)
+	{
+		CompactDeadSlots();
+	}
+
+	return EndLocation;
+}
+
+/**
+ * Reads a slot's velocity back out for gameplay/Blueprint queries.
+ */
+FVector UNeonProjectileSimSubsystem::GetSimulatedVelocity(const ANeonProjectile* Projectile) const
+{
+	if (!Projectile || Projectile->SimSlotIndex == INDEX_NONE)
+	{
+		return FVector::ZeroVector;
+	}
+
+	const int32 SlotIndex = Projectile->SimSlotIndex;
+	return FVector(SimData.VelX[SlotIndex], SimData.VelY[SlotIndex], SimData.VelZ[SlotIndex]);
+}
+
+// ========================================
+// Update
+// ========================================
+
+/**
+ * One batched update for every projectile in the world: as many fixed steps as the frame time covers,
+ * then one interpolated render write-back.
+ */
+void UNeonProjectileSimSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	NEON_COMBAT_SCOPE(STAT_NeonProjectileSimTick);
+	SET_DWORD_STAT(STAT_NeonLiveProjectiles, SimData.Num());
+
+	if (SimData.Num() == 0)
+	{
+		// Nothing in flight - don't bank time for the next launch
+		StepAccumulator = 0.0;
+		return;
+	}
+
+	bIsUpdating = true;
+	++FrameCounter;
+
+	GatherOwnerPositions();
+
+	float RenderAlpha = 1.f;
+	const int32 StepHz = CVarNeonProjectileFixedStepHz.GetValueOnGameThread();
+
+	if (StepHz <= 0)
+	{
+		RunStep(DeltaTime);
+	}
+	else
+	{
+		const double StepTime = 1.0 / StepHz;
+		const int32 MaxSubSteps = FMath::Max(1, CVarNeonProjectileMaxSubSteps.GetValueOnGameThread());
+
+		StepAccumulator += DeltaTime;
+
+		int32 NumSteps = FMath::FloorToInt32(StepAccumulator / StepTime);
+		if (NumSteps > MaxSubSteps)
+		{
+			NumSteps = MaxSubSteps;
+			StepAccumulator = MaxSubSteps * StepTime;
+		}
+
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			RunStep(static_cast<float>(StepTime));
+		}
+
+		StepAccumulator -= NumSteps * StepTime;
+		RenderAlpha = static_cast<float>(StepAccumulator / StepTime);
+	}
+
+	WriteBackTransforms(RenderAlpha);
+
+	bIsUpdating = false;
+	FrameRegistry = nullptr;
+
+	CompactDeadSlots();
+}
+
+/**
+ * Phase changes and catches are dispatched per step, so a catch in the first of several steps
+ * frees its slot before the later steps move it further.
+ */
+void UNeonProjectileSimSubsystem::RunStep(float StepTime)
+{
+	// Remember where every slot started this step (swept path start, render interpolation)
+	SimData.PrevX = SimData.PosX;
+	SimData.PrevY = SimData.PosY;
+	SimData.PrevZ = SimData.PosZ;
+
+	StepSimulation(StepTime);
+	ResolveSpatialHashHits();
+	SweepPhysicsSlots();
+	DispatchEvents();
+}
+
+TStatId UNeonProjectileSimSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNeonProjectileSimSubsystem, STATGROUP_Tickables);
+}
+
+/**
+ * Owners are resolved once per frame, so projectiles never touch owner actors in the hot loop.
+ */
+void UNeonProjectileSimSubsystem::GatherOwnerPositions()
+{
+	for (int32 OwnerIdx = 0; OwnerIdx < Owners.Num(); ++OwnerIdx)
+	{
+		const AActor* Owner = OwnerRefCounts[OwnerIdx] > 0 ? Owners[OwnerIdx].Get() : nullptr;
+		OwnerValid[OwnerIdx] = Owner != nullptr;
+
+		if (Owner)
+		{
+			const FVector Location = Owner->GetActorLocation();
+			OwnerX[OwnerIdx] = Location.X;
+			OwnerY[OwnerIdx] = Location.Y;
+			OwnerZ[OwnerIdx] = Location.Z;
+		}
+	}
+}
+
+/**
+ * Advances all slots with the boomerang phase/homing kernel.
+ *
+ * A scalar gather pass first resolves each slot's owner into flat target/mask streams,
+ * so the kernel itself only streams through contiguous floats.
+ */
+void UNeonProjectileSimSubsystem::StepSimulation(float DeltaTime)
+{
+	NEON_COMBAT_SCOPE(STAT_NeonProjectileStep);
+
+	const int32 NumSlots = SimData.Num();
+	const uint8 ReturningPhase = static_cast<uint8>(EProjectilePhase::Returning);
+
+	PendingReturnSlots.Reset();
+	PendingCaughtSlots.Reset();
+
+	// ========================================
+	// Gather Owner Targets
+	// ========================================
+	TargetX.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	TargetY.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	TargetZ.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	BoomerangMask.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+	ReturningMask.SetNumUninitialized(NumSlots, EAllowShrinking::No);
+
+	for (int32 Index = 0; Index < NumSlots; ++Index)
+	{
+		const int32 OwnerIdx = SimData.OwnerIndex[Index];
+		const bool bHasOwner = OwnerIdx != INDEX_NONE && OwnerValid[OwnerIdx];
+		const bool bIsBoomerang = (SimData.Flags[Index] & NeonSim_Boomerang) != 0;
+
+		// Slots without a live owner fly straight, so their target is never used
+		TargetX[Index] = bHasOwner ? OwnerX[OwnerIdx] : SimData.PosX[Index];
+		TargetY[Index] = bHasOwner ? OwnerY[OwnerIdx] : SimData.PosY[Index];
+		TargetZ[Index] = bHasOwner ? OwnerZ[OwnerIdx] : SimData.PosZ[Index];
+		BoomerangMask[Index] = (bIsBoomerang && bHasOwner) ? 1.f : 0.f;
+		ReturningMask[Index] = SimData.Phase[Index] == ReturningPhase ? 1.f : 0.f;
+	}
+
+	// ========================================
+	// Run Kernel
+	// ========================================
+	FNeonProjectileKernelStreams Streams;
+	Streams.Num = NumSlots;
+	Streams.PosX = SimData.PosX.GetData();
+	Streams.PosY = SimData.PosY.GetData();
+	Streams.PosZ = SimData.PosZ.GetData();
+	Streams.VelX = SimData.VelX.GetData();
+	Streams.VelY = SimData.VelY.GetData();
+	Streams.VelZ = SimData.VelZ.GetData();
+	Streams.Phase = SimData.Phase.GetData();
+	Streams.StartX = SimData.StartX.GetData();
+	Streams.StartY = SimData.StartY.GetData();
+	Streams.StartZ = SimData.StartZ.GetData();
+	Streams.MaxDistanceSq = SimData.MaxDistanceSq.GetData();
+	Streams.MaxSpeed = SimData.MaxSpeed.GetData();
+	Streams.HomingAcceleration = SimData.HomingAcceleration.GetData();
+	Streams.CatchRadiusSq = SimData.CatchRadiusSq.GetData();
+	Streams.TargetX = TargetX.GetData();
+	Streams.TargetY = TargetY.GetData();
+	Streams.TargetZ = TargetZ.GetData();
+	Streams.BoomerangMask = BoomerangMask.GetData();
+	Streams.ReturningMask = ReturningMask.GetData();
+
+	if (CVarNeonProjectileSimdKernel.GetValueOnGameThread())
+	{
+		NeonProjectileKernel::StepSimd(Streams, DeltaTime, PendingReturnSlots, PendingCaughtSlots);
+	}
+	else
+	{
+		NeonProjectileKernel::StepScalar(Streams, 0, NumSlots, DeltaTime, PendingReturnSlots, PendingCaughtSlots);
+	}
+}
+
+/**
+ * Spatial-hash hit detection.
+ *
+ * Each slot's path this step (Prev -> Pos) is traced against world geometry first; pawn hits are
+ * only accepted up to the wall. Pawn hits are routed through HandleCollisionLogic in the order the
+ * sphere reaches them, so the once-per-phase and phase-specific effect rules are identical to the
+ * physics overlap path. The wall response runs last, after every pawn in front of it was hit.
+ */
+void UNeonProjectileSimSubsystem::ResolveSpatialHashHits()
+{
+	NEON_COMBAT_SCOPE(STAT_NeonProjectileHashHits);
+
+	const int32 NumSlots = SimData.Num();
+
+	for (int32 Index = 0; Index < NumSlots; ++Index)
+	{
+		if (!SlotViews[Index] || (SimData.Flags[Index] & NeonSim_SpatialHashHits) == 0)
+		{
+			continue;
+		}
+
+		// Only pay for the grid refresh when at least one projectile uses it, and only once per frame:
+		// pawns don't move between the frame's steps
+		if (!FrameRegistry)
+		{
+			FrameRegistry = GetWorld()->GetSubsystem<UNeonCombatPawnRegistry>();
+			if (!FrameRegistry)
+			{
+				return;
+			}
+			FrameRegistry->RefreshSpatialHash();
+		}
+
+		ResolveSpatialHashSlot(Index, *FrameRegistry);
+	}
+}
+
+/**
+ * Traces the slot's path against world geometry, sweeps it against the pawn grid up to the wall,
+ * then applies the wall response.
+ */
+void UNeonProjectileSimSubsystem::ResolveSpatialHashSlot(int32 SlotIndex, UNeonCombatPawnRegistry& Registry)
+{
+	ANeonProjectile* View = SlotViews[SlotIndex];
+	UWorld* World = GetWorld();
+
+	const FVector Start(SimData.PrevX[SlotIndex], SimData.PrevY[SlotIndex], SimData.PrevZ[SlotIndex]);
+	FVector End(SimData.PosX[SlotIndex], SimData.PosY[SlotIndex], SimData.PosZ[SlotIndex]);
+	const float Radius = SimData.CollisionRadius[SlotIndex];
+
+	// ========================================
+	// World Geometry
+	// ========================================
+	FCollisionObjectQueryParams WorldObjects;
+	WorldObjects.AddObjectTypesToQuery(ECC_WorldStatic);
+	WorldObjects.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(NeonProjectileWorldTrace), false, View);
+	if (AActor* Owner = View->GetOwner())
+	{
+		QueryParams.AddIgnoredActor(Owner);
+	}
+
+	FHitResult WorldHit;
+	const bool bHitWorld = World->LineTraceSingleByObjectType(WorldHit, Start, End, WorldObjects, QueryParams);
+	if (bHitWorld)
+	{
+		// Stop one radius short of the surface, like the swept sphere would
+		End = WorldHit.Location - (End - Start).GetSafeNormal() * Radius;
+	}
+
+	// ========================================
+	// Pawns
+	// ========================================
+	Registry.QuerySweptSphere(Start, End, Radius, PawnHitScratch);
+
+	for (const FNeonPawnSweepHit& PawnHit : PawnHitScratch)
+	{
+		// Standard projectiles end their flight on the first hit
+		if (SlotViews[SlotIndex] != View)
+		{
+			break;
+		}
+
+		if (APlayerCharacter* Pawn = Registry.GetPawn(PawnHit.PawnIndex))
+		{
+			View->HandleCollisionLogic(Pawn);
+		}
+	}
+
+	if (SlotViews[SlotIndex] != View)
+	{
+		return;
+	}
+
+	if (bHitWorld)
+	{
+		SimData.PosX[SlotIndex] = End.X;
+		SimData.PosY[SlotIndex] = End.Y;
+		SimData.PosZ[SlotIndex] = End.Z;
+
+		View->HandleBlockingHit(WorldHit.GetActor(), WorldHit);
+	}
+}
+
+/**
+ * Moves physics-sweep projectiles to their simulated position with a sweep, every step.
+ */
+void UNeonProjectileSimSubsystem::SweepPhysicsSlots()
+{
+	NEON_COMBAT_SCOPE(STAT_NeonProjectileWriteBack);
+
+	const int32 NumSlots = SimData.Num();
+
+	for (int32 Index = 0; Index < NumSlots; ++Index)
+	{
+		if (SlotViews[Index] && (SimData.Flags[Index] & NeonSim_PhysicsSweep) != 0)
+		{
+			SweepPhysicsSlot(Index);
+		}
+	}
+}
+
+/**
+ * The swept (possibly blocked) location is fed back into the simulation.
+ */
+void UNeonProjectileSimSubsystem::SweepPhysicsSlot(int32 SlotIndex)
+{
+	ANeonProjectile* View = SlotViews[SlotIndex];
+
+	const FVector TargetLocation(SimData.PosX[SlotIndex], SimData.PosY[SlotIndex], SimData.PosZ[SlotIndex]);
+	const FVector Velocity(SimData.VelX[SlotIndex], SimData.VelY[SlotIndex], SimData.VelZ[SlotIndex]);
+
+	// Callbacks fired by the sweep may unregister this projectile (slot is then only marked dead)
+	const FVector ActualLocation = View->ApplySimulatedTransform(TargetLocation, Velocity.Rotation(), true);
+
+	if (SlotViews[SlotIndex] == View)
+	{
+		SimData.PosX[SlotIndex] = ActualLocation.X;
+		SimData.PosY[SlotIndex] = ActualLocation.Y;
+		SimData.PosZ[SlotIndex] = ActualLocation.Z;
+	}
+}
+
+/**
+ * Moves projectiles to their render transform, once per frame.
+ *
+ * The position is interpolated between the last two steps so motion stays smooth when the frame rate
+ * and step rate differ. Projectiles are only moved while visible, plus a staggered refresh so culling bounds don't go stale.
+ * Physics-sweep projectiles already sit at their latest step and moving their collision backwards would re-trigger
+ * overlaps, so only their mesh is offset to the interpolated position.
+ */
+void UNeonProjectileSimSubsystem::WriteBackTransforms(float Alpha)
+{
+	NEON_COMBAT_SCOPE(STAT_NeonProjectileWriteBack);
+
+	const int32 NumSlots = SimData.Num();
+
+	for (int32 Index = 0; Index < NumSlots; ++Index)
+	{
+		ANeonProjectile* View = SlotViews[Index];
+		if (!View)
+		{
+			continue;
+		}
+
+		const bool bStaleRefresh = ((FrameCounter + static_cast<uint32>(Index)) % HiddenWriteBackInterval) == 0;
+		if (!bStaleRefresh && !View->WasRecentlyRendered(VisibilityTolerance))
+		{
+			continue;
+		}
+
+		const FVector RenderLocation(
+			FMath::Lerp(SimData.PrevX[Index], SimData.PosX[Index], Alpha),
+			FMath::Lerp(SimData.PrevY[Index], SimData.PosY[Index], Alpha),
+			FMath::Lerp(SimData.PrevZ[Index], SimData.PosZ[Index], Alpha)
+		);
+
+		if ((SimData.Flags[Index] & NeonSim_PhysicsSweep) != 0)
+		{
+			View->ApplyRenderLocation(RenderLocation);
+			continue;
+		}
+
+		const FVector Velocity(SimData.VelX[Index], SimData.VelY[Index], SimData.VelZ[Index]);
+		View->ApplySimulatedTransform(RenderLocation, Velocity.Rotation(), false);
+	}
+}
+
+/**
+ * Tells projectile actors about phase changes and catches.
+ * Runs at the end of each step, after hits and sweeps and before the frame's render write-back.
+ */
+void UNeonProjectileSimSubsystem::DispatchEvents()
+{
+	for (const int32 SlotIndex : PendingReturnSlots)
+	{
+		if (ANeonProjectile* View = SlotViews[SlotIndex])
+		{
+			View->HandleReturnPhaseStarted();
+		}
+	}
+
+	for (const int32 SlotIndex : PendingCaughtSlots)
+	{
+		if (ANeonProjectile* View = SlotViews[SlotIndex])
+		{
+			View->HandleReturnedToOwner();
+		}
+	}
+}
+
+/**
+ * Removes slots that were unregistered during the update.
+ * Walks backwards so every slot swapped into a hole has already been checked.
+ */
+void UNeonProjectileSimSubsystem::CompactDeadSlots()
+{
+	for (int32 Index = SlotViews.Num() - 1; Index >= 0; --Index)
+	{
+		if (!SlotViews[Index])
+		{
+			RemoveSlot(Index);
+		}
+	}
+}
+
+/**
+ * Removes one slot and fixes up the index of the projectile that was swapped into its place.
+ */
+void UNeonProjectileSimSubsystem::RemoveSlot(int32 SlotIndex)
+{
+	ReleaseOwnerIndex(SimData.OwnerIndex[SlotIndex]);
+
+	SimData.RemoveSlotAtSwap(SlotIndex);
+	SlotViews.RemoveAtSwap(SlotIndex, EAllowShrinking::No);
+
+	if (SlotViews.IsValidIndex(SlotIndex) && SlotViews[SlotIndex])
+	{
+		SlotViews[SlotIndex]->SimSlotIndex = SlotIndex;
+	}
+}
+
+// ========================================
+// Owner Table
+// ========================================
+
+/**
+ * Returns the owner table entry for an actor, creating one if needed.
+ */
+int32 UNeonProjectileSimSubsystem::AcquireOwnerIndex(AActor* Owner)
+{
+	if (!Owner)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Existing = OwnerLookup.Find(Owner))
+	{
+		++OwnerRefCounts[*Existing];
+		return *Existing;
+	}
+
+	int32 OwnerIdx;
+	if (FreeOwnerIndices.Num() > 0)
+	{
+		OwnerIdx = FreeOwnerIndices.Pop(EAllowShrinking::No);
+		Owners[OwnerIdx] = Owner;
+		OwnerRefCounts[OwnerIdx] = 1;
+	}
+	else
+	{
+		OwnerIdx = Owners.Add(Owner);
+		OwnerRefCounts.Add(1);
+		OwnerX.Add(0.f);
+		OwnerY.Add(0.f);
+		OwnerZ.Add(0.f);
+		OwnerValid.Add(0);
+	}
+
+	// Valid immediately so a projectile registered mid-frame can home this frame
+	const FVector Location = Owner->GetActorLocation();
+	OwnerX[OwnerIdx] = Location.X;
+	OwnerY[OwnerIdx] = Location.Y;
+	OwnerZ[OwnerIdx] = Location.Z;
+	OwnerValid[OwnerIdx] = 1;
+
+	OwnerLookup.Add(Owner, OwnerIdx);
+	return OwnerIdx;
+}
+
+/**
+ * Drops a reference; frees the entry once no projectile points at it.
+ */
+void UNeonProjectileSimSubsystem::ReleaseOwnerIndex(int32 OwnerIdx)
+{
+	if (OwnerIdx == INDEX_NONE || --OwnerRefCounts[OwnerIdx] > 0)
+	{
+		return;
+	}
+
+	// Remove by value - the actor may already be gone, so the weak pointer can't be used as the key
+	for (auto It = OwnerLookup.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == OwnerIdx)
+		{
+			It.RemoveCurrent();
+			break;
+		}
+	}
+
+	Owners[OwnerIdx].Reset();
+	OwnerValid[OwnerIdx] = 0;
+	FreeOwnerIndices.Add(OwnerIdx);
+}
+
+// ========================================
+// Subsystem
+// ========================================
+
+/**
+ * Clears all simulation state when the world goes away.
+ */
+void UNeonProjectileSimSubsystem::Deinitialize()
+{
+	for (ANeonProjectile* View : SlotViews)
+	{
+		if (View)
+		{
+			View->SimSlotIndex = INDEX_NONE;
+		}
+	}
+
+	SimData.Reset();
+	SlotViews.Reset();
+	Owners.Reset();
+	OwnerRefCounts.Reset();
+	OwnerX.Reset();
+	OwnerY.Reset();
+	OwnerZ.Reset();
+	OwnerValid.Reset();
+	OwnerLookup.Reset();
+	FreeOwnerIndices.Reset();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds fire projectiles.
+ */
+bool UNeonProjectileSimSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
\ No newline at end of file
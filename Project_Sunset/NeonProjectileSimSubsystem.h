@@ -0,0 +1,274 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonCombatPawnRegistry.h"
+#include "NeonProjectileSimSubsystem.generated.h"
+
+// Forward declarations
+class ANeonProjectile;
+
+/**
+ * Structure-of-arrays storage for every live projectile in the world.
+ * Slot i of every array belongs to the same projectile, so each pass of the
+ * simulation walks a handful of tightly packed float streams instead of chasing actor pointers.
+ *
+ * Positions are stored as floats - plenty of precision for arena-scale combat.
+ */
+struct FNeonProjectileSimData
+{
+	/** Current position */
+	TArray<float> PosX, PosY, PosZ;
+
+	/** Position at the start of the last step (swept path start, render interpolation) */
+	TArray<float> PrevX, PrevY, PrevZ;
+
+	/** Current velocity (units per second) */
+	TArray<float> VelX, VelY, VelZ;
+
+	/** Launch position (boomerang outgoing distance is measured from here) */
+	TArray<float> StartX, StartY, StartZ;
+
+	/** Squared outgoing distance before a boomerang turns around */
+	TArray<float> MaxDistanceSq;
+
+	/** Speed cap applied after homing acceleration */
+	TArray<float> MaxSpeed;
+
+	/** Homing acceleration toward the owner during the return phase */
+	TArray<float> HomingAcceleration;
+
+	/** Squared distance to the owner at which a returning boomerang is caught */
+	TArray<float> CatchRadiusSq;
+
+	/** Collision sphere radius (spatial hash hit queries) */
+	TArray<float> CollisionRadius;
+
+	/** Current EProjectilePhase stored as a byte */
+	TArray<uint8> Phase;
+
+	/** Per-slot ENeonProjectileSimFlags */
+	TArray<uint8> Flags;
+
+	/** Index into the owner table, or INDEX_NONE when the projectile has no return target */
+	TArray<int32> OwnerIndex;
+
+	/** Number of live slots */
+	int32 Num() const { return PosX.Num(); }
+
+	/** Appends a zero-initialized slot and returns its index */
+	int32 AddSlot();
+
+	/** Removes a slot by swapping the last slot into it */
+	void RemoveSlotAtSwap(int32 SlotIndex);
+
+	/** Drops every slot but keeps the allocations */
+	void Reset();
+};
+
+/** Per-slot flag bits stored in FNeonProjectileSimData::Flags */
+enum ENeonProjectileSimFlags : uint8
+{
+	/** Slot flies out and comes back (otherwise it flies straight until it hits something) */
+	NeonSim_Boomerang = 1 << 0,
+
+	/** Slot's collision component must be swept every step (physics overlaps/hits drive gameplay) */
+	NeonSim_PhysicsSweep = 1 << 1,
+
+	/** Slot resolves pawn hits through UNeonCombatPawnRegistry and walls through a line trace */
+	NeonSim_SpatialHashHits = 1 << 2,
+};
+
+/**
+ * Central simulation manager for ANeonProjectile.
+ *
+ * Replaces per-actor Tick and UProjectileMovementComponent updates with one batched update per frame:
+ * 1. Gather owner positions once into a small table
+ * 2. Run fixed-length steps (neon.Projectile.FixedStepHz, 60 by default) for the time accumulated this frame.
+ *    Each step:
+ *    a. Advances every projectile (homing, movement, phase transitions) in tight loops over the SoA
+ *    b. Resolves hits for spatial-hash projectiles (swept sphere vs pawn grid, line trace vs world)
+ *    c. Sweeps projectiles that rely on physics overlaps to their new position
+ *    d. Dispatches phase changes and catches back to the projectile actors
+ * 3. Write interpolated transforms (between the last two steps) to the projectiles, only when recently rendered
+ *    (or every few frames to keep bounds fresh). Physics-sweep projectiles only offset their mesh; collision stays at the step
+ *
+ * With fixed steps, turn-around points, catches and hits come out the same at 20 or 200 fps,
+ * and a hitch can't make a projectile skip its catch radius. FixedStepHz=0 steps once per frame with the frame time.
+ *
+ * ANeonProjectile is a thin view over a slot: it registers when it starts flying and unregisters when it stops.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonProjectileSimSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// Slot Management
+	// ========================================
+
+	/**
+	 * Adds a projectile to the simulation using its current transform and movement settings.
+	 *
+	 * @param Projectile - Projectile to simulate
+	 * @return Slot index (also stored on the projectile)
+	 */
+	int32 RegisterProjectile(ANeonProjectile* Projectile);
+
+	/** Removes a projectile from the simulation (deferred if called during the update) */
+	void UnregisterProjectile(ANeonProjectile* Projectile);
+
+	/** Copies boomerang settings (owner, start location, max distance, phase) from the projectile into its slot */
+	void SyncBoomerangState(const ANeonProjectile* Projectile);
+
+	/**
+	 * Switches a slot into the return phase immediately (e.g. after hitting a wall)
+	 * and points its velocity back toward the owner.
+	 */
+	void ForceReturnPhase(const ANeonProjectile* Projectile);
+
+	/** Moves a slot without sweeping (fast-forwarding a replica or reconciling a networked flight) */
+	void TeleportProjectile(const ANeonProjectile* Projectile, const FVector& Location, const FVector& Velocity);
+
+	/**
+	 * Moves a slot from its current position to Location, resolving hits along the way exactly like a step
+	 * (fast-forwarding the server's authoritative flight). Hit callbacks may end the flight.
+	 *
+	 * @param Projectile - Projectile to move
+	 * @param Location - Where the projectile would be without hits
+	 * @param Velocity - Velocity at Location
+	 * @return Where the projectile ended up (short of Location if a wall stopped it)
+	 */
+	FVector SweepProjectile(ANeonProjectile* Projectile, const FVector& Location, const FVector& Velocity);
+
+	/** Current simulated velocity of a projectile (zero if not simulated) */
+	FVector GetSimulatedVelocity(const ANeonProjectile* Projectile) const;
+
+	/** Number of projectiles currently being simulated */
+	int32 GetNumSimulatedProjectiles() const { return SimData.Num(); }
+
+	// ========================================
+	// FTickableGameObject Interface
+	// ========================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// USubsystem Interface
+	// ========================================
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds simulate projectiles */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Looks up (or adds) an owner table entry and bumps its reference count */
+	int32 AcquireOwnerIndex(AActor* Owner);
+
+	/** Drops one reference to an owner table entry */
+	void ReleaseOwnerIndex(int32 OwnerIdx);
+
+	/** Refreshes OwnerX/Y/Z from the live owner actors */
+	void GatherOwnerPositions();
+
+	/** One simulation step: kernel, hits, physics sweeps, events */
+	void RunStep(float StepTime);
+
+	/** Gathers owner targets and runs the phase/homing kernel over every slot */
+	void StepSimulation(float DeltaTime);
+
+	/**
+	 * Hit detection for spatial-hash slots: sweeps each slot's step against the combat pawn grid
+	 * and traces it against world geometry, then routes hits to the projectile in sweep order.
+	 */
+	void ResolveSpatialHashHits();
+
+	/** Spatial-hash hit detection for one slot's path this step (Prev -> Pos) */
+	void ResolveSpatialHashSlot(int32 SlotIndex, UNeonCombatPawnRegistry& Registry);
+
+	/** Sweeps physics-overlap projectiles to their simulated position (their collision is the hit test) */
+	void SweepPhysicsSlots();
+
+	/** Sweeps one physics-overlap slot to its simulated position and feeds the swept location back */
+	void SweepPhysicsSlot(int32 SlotIndex);
+
+	/**
+	 * Pushes render transforms to the projectiles (the mesh only, for physics-sweep projectiles).
+	 *
+	 * @param Alpha - Interpolation between the previous and the current step (1 = current)
+	 */
+	void WriteBackTransforms(float Alpha);
+
+	/** Notifies projectile actors about phase transitions and catches found during the step */
+	void DispatchEvents();
+
+	/** Removes slots whose projectile unregistered while the update was running */
+	void CompactDeadSlots();
+
+	/** Releases a slot's owner reference and removes it */
+	void RemoveSlot(int32 SlotIndex);
+
+	/** Live projectile state */
+	FNeonProjectileSimData SimData;
+
+	/** Projectile actor for each slot (nullptr = unregistered during update, removed at the end of the frame) */
+	UPROPERTY()
+	TArray<ANeonProjectile*> SlotViews;
+
+	// ========================================
+	// Owner Table
+	// ========================================
+
+	/** Actors that boomerangs return to (shared by every projectile they fired) */
+	TArray<TWeakObjectPtr<AActor>> Owners;
+
+	/** Number of slots referencing each owner entry */
+	TArray<int32> OwnerRefCounts;
+
+	/** Owner positions gathered once per frame */
+	TArray<float> OwnerX, OwnerY, OwnerZ;
+
+	/** Whether the owner was still alive when positions were gathered */
+	TArray<uint8> OwnerValid;
+
+	/** Owner actor -> owner table index */
+	TMap<TObjectKey<AActor>, int32> OwnerLookup;
+
+	/** Unused owner table entries */
+	TArray<int32> FreeOwnerIndices;
+
+	// ========================================
+	// Per-frame Scratch
+	// ========================================
+
+	/** Pawn registry with its grid refreshed this frame (set by the first step that needs it, cleared after the update) */
+	UNeonCombatPawnRegistry* FrameRegistry = nullptr;
+
+	/** Pawn hits found for the slot currently being resolved */
+	TArray<FNeonPawnSweepHit> PawnHitScratch;
+
+	/** Owner position per slot, gathered before each kernel run */
+	TArray<float> TargetX, TargetY, TargetZ;
+
+	/** Kernel lane masks (1.0 / 0.0) gathered before each kernel run */
+	TArray<float> BoomerangMask, ReturningMask;
+
+	/** Slots that switched to the return phase this step */
+	TArray<int32> PendingReturnSlots;
+
+	/** Slots that reached their owner this step */
+	TArray<int32> PendingCaughtSlots;
+
+	/** True while Tick is running (slot removal is deferred) */
+	bool bIsUpdating = false;
+
+	/** Frame counter used to refresh transforms of projectiles that aren't being rendered */
+	uint32 FrameCounter = 0;
+
+	/** Frame time not yet simulated by a fixed step */
+	double StepAccumulator = 0.0;
+};
\ No newline at end of file
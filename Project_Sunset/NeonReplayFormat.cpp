@@ -0,0 +1,432 @@
+#include "NeonReplayFormat.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Serialization/LargeMemoryReader.h"
+#include "Algo/BinarySearch.h"
+
+/**
+ * Same layout in the stream and in the footer.
+ */
+FArchive& operator<<(FArchive& Ar, FNeonReplayActorInfo& Info)
+{
+	Ar << Info.Id << Info.ClassIndex << Info.Name << Info.Location << Info.Rotation << Info.bPlayerControlled;
+	return Ar;
+}
+
+// ========================================
+// FNeonReplayWriter
+// ========================================
+
+/**
+ * Finishes the file if the owner didn't.
+ */
+FNeonReplayWriter::~FNeonReplayWriter()
+{
+	Close();
+}
+
+/**
+ * Starts a fresh file; ids and class indices are per file.
+ */
+bool FNeonReplayWriter::Open(const FString& Path, const FString& MapName)
+{
+	Close();
+
+	Archive.Reset(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Archive.IsValid())
+	{
+		return false;
+	}
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	FString Map = MapName;
+	*Archive << Magic << Version << Map;
+
+	ClassIndices.Reset();
+	ClassPaths.Reset();
+	ActorIds.Reset();
+	Actors.Reset();
+	FrameIndex.Reset();
+	FrameIndex.Emplace(0, Archive->Tell());
+	NumFrames = 0;
+	return true;
+}
+
+/**
+ * Footer: tables and frame index, then its offset and magic so readers find it from the end.
+ */
+void FNeonReplayWriter::Close()
+{
+	if (!Archive.IsValid())
+	{
+		return;
+	}
+
+	FArchive& Ar = *Archive;
+
+	int64 FooterOffset = Ar.Tell();
+	uint8 Kind = static_cast<uint8>(ENeonReplayRecord::Footer);
+	Ar << Kind << NumFrames << ClassPaths << Actors;
+
+	int32 NumIndexEntries = FrameIndex.Num();
+	Ar << NumIndexEntries;
+	for (TPair<uint32, int64>& Entry : FrameIndex)
+	{
+		Ar << Entry.Key << Entry.Value;
+	}
+
+	uint32 Magic = FooterMagic;
+	Ar << FooterOffset << Magic;
+
+	Archive->Close();
+	Archive.Reset();
+}
+
+/**
+ * The actor's transform at first use is where playback spawns it.
+ */
+uint32 FNeonReplayWriter::GetActorId(AActor* Actor, bool bPlayerControlled)
+{
+	if (!Actor)
+	{
+		return 0;
+	}
+
+	if (const uint32* Existing = ActorIds.Find(Actor))
+	{
+		return *Existing;
+	}
+
+	FNeonReplayActorInfo& Info = Actors.AddDefaulted_GetRef();
+	Info.Id = Actors.Num();
+	Info.ClassIndex = GetClassIndex(Actor->GetClass());
+	Info.Name = Actor->GetName();
+	Info.Location = Actor->GetActorLocation();
+	Info.Rotation = Actor->GetActorRotation();
+	Info.bPlayerControlled = bPlayerControlled;
+	ActorIds.Add(Actor, Info.Id);
+
+	BeginRecord(ENeonReplayRecord::Actor) << Info;
+	return Info.Id;
+}
+
+/**
+ * Classes are stored by path so playback can load them.
+ */
+int32 FNeonReplayWriter::GetClassIndex(const UClass* Class)
+{
+	if (!Class)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Existing = ClassIndices.Find(Class))
+	{
+		return *Existing;
+	}
+
+	int32 Index = ClassPaths.Add(Class->GetPathName());
+	ClassIndices.Add(Class, Index);
+
+	BeginRecord(ENeonReplayRecord::ClassDef) << Index << ClassPaths[Index];
+	return Index;
+}
+
+/**
+ * Payloads are written by the caller right after this.
+ */
+FArchive& FNeonReplayWriter::BeginRecord(ENeonReplayRecord Kind)
+{
+	uint8 KindByte = static_cast<uint8>(Kind);
+	*Archive << KindByte;
+	return *Archive;
+}
+
+/**
+ * Adds a frame index entry every IndexInterval frames.
+ */
+void FNeonReplayWriter::EndFrame(float DeltaTime)
+{
+	BeginRecord(ENeonReplayRecord::FrameEnd) << DeltaTime;
+
+	++NumFrames;
+	if (NumFrames % IndexInterval == 0)
+	{
+		FrameIndex.Emplace(NumFrames, Archive->Tell());
+	}
+}
+
+// ========================================
+// FNeonReplayReader
+// ========================================
+
+FNeonReplayReader::FNeonReplayReader() = default;
+
+/**
+ * Unmaps the file.
+ */
+FNeonReplayReader::~FNeonReplayReader()
+{
+	Close();
+}
+
+/**
+ * Maps the whole file read-only; the OS pages it in as records are read.
+ */
+bool FNeonReplayReader::Open(const FString& Path)
+{
+	Close();
+
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+	if (!MappedFile.IsValid() || MappedFile->GetFileSize() == 0)
+	{
+		Close();
+		return false;
+	}
+
+	MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	if (!MappedRegion.IsValid())
+	{
+		Close();
+		return false;
+	}
+
+	Archive = MakeUnique<FLargeMemoryReader>(MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize());
+	StreamEnd = MappedRegion->GetMappedSize();
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*Archive << Magic << Version;
+	if (Magic != FNeonReplayWriter::FileMagic || Version != FNeonReplayWriter::FileVersion)
+	{
+		Close();
+		return false;
+	}
+
+	*Archive << MapName;
+	const int64 FirstRecord = Archive->Tell();
+
+	bHasFooter = ReadFooter();
+
+	Archive->Seek(FirstRecord);
+	CurrentFrame = 0;
+	return !Archive->IsError();
+}
+
+/**
+ * Safe to call on a closed reader.
+ */
+void FNeonReplayReader::Close()
+{
+	Archive.Reset();
+	MappedRegion.Reset();
+	MappedFile.Reset();
+
+	MapName.Reset();
+	ClassPaths.Reset();
+	Actors.Reset();
+	FrameIndex.Reset();
+	StreamEnd = 0;
+	CurrentFrame = 0;
+	NumFrames = 0;
+	bHasFooter = false;
+}
+
+/**
+ * Files without a footer (recording cut short) are read up to the first undecodable byte.
+ */
+bool FNeonReplayReader::ReadRecord(FNeonReplayRecord& OutRecord)
+{
+	FArchive& Ar = *Archive;
+
+	while (Ar.Tell() < StreamEnd && !Ar.IsError())
+	{
+		uint8 KindByte = 0;
+		Ar << KindByte;
+
+		OutRecord.Kind = static_cast<ENeonReplayRecord>(KindByte);
+		switch (OutRecord.Kind)
+		{
+		case ENeonReplayRecord::ClassDef:
+		{
+			int32 Index = INDEX_NONE;
+			FString Path;
+			Ar << Index << Path;
+			if (Index >= 0)
+			{
+				if (ClassPaths.Num() <= Index)
+				{
+					ClassPaths.SetNum(Index + 1);
+				}
+				ClassPaths[Index] = MoveTemp(Path);
+			}
+			continue;
+		}
+
+		case ENeonReplayRecord::Actor:
+			Ar << OutRecord.Actor;
+			OutRecord.ActorId = OutRecord.Actor.Id;
+			AddActor(OutRecord.Actor);
+			break;
+
+		case ENeonReplayRecord::Move:
+			Ar << OutRecord.ActorId << OutRecord.Axis;
+			break;
+
+		case ENeonReplayRecord::Look:
+			Ar << OutRecord.ActorId << OutRecord.Axis << OutRecord.Rotation;
+			break;
+
+		case ENeonReplayRecord::SprintStart:
+		case ENeonReplayRecord::SprintStop:
+			Ar << OutRecord.ActorId;
+			break;
+
+		case ENeonReplayRecord::AbilityActivated:
+			Ar << OutRecord.ActorId << OutRecord.ClassIndex;
+			break;
+
+		case ENeonReplayRecord::ProjectileSpawn:
+			Ar << OutRecord.ActorId << OutRecord.ClassIndex << OutRecord.Location << OutRecord.Rotation << OutRecord.Value;
+			break;
+
+		case ENeonReplayRecord::EffectApplied:
+			Ar << OutRecord.ActorId << OutRecord.TargetId << OutRecord.ClassIndex << OutRecord.Value;
+			break;
+
+		case ENeonReplayRecord::FrameEnd:
+			Ar << OutRecord.Value;
+			++CurrentFrame;
+			break;
+
+		default:
+			// Footer, or garbage at the end of a truncated file
+			return false;
+		}
+
+		return !Ar.IsError();
+	}
+
+	return false;
+}
+
+/**
+ * Jumps to the closest indexed frame, then decodes forward to the requested one.
+ */
+bool FNeonReplayReader::SeekToFrame(uint32 Frame)
+{
+	if (!bHasFooter || Frame > NumFrames)
+	{
+		return false;
+	}
+
+	const int32 EntryIndex = Algo::UpperBoundBy(FrameIndex, Frame, &TPair<uint32, int64>::Key) - 1;
+	if (!FrameIndex.IsValidIndex(EntryIndex))
+	{
+		return false;
+	}
+
+	Archive->Seek(FrameIndex[EntryIndex].Value);
+	CurrentFrame = FrameIndex[EntryIndex].Key;
+
+	FNeonReplayRecord Skipped;
+	while (CurrentFrame < Frame && ReadRecord(Skipped))
+	{
+	}
+
+	return CurrentFrame == Frame;
+}
+
+/**
+ * Empty string for indices the reader hasn't seen.
+ */
+const FString& FNeonReplayReader::GetClassPath(int32 ClassIndex) const
+{
+	static const FString Unknown;
+	return ClassPaths.IsValidIndex(ClassIndex) ? ClassPaths[ClassIndex] : Unknown;
+}
+
+/**
+ * Ids are 1-based and dense.
+ */
+const FNeonReplayActorInfo* FNeonReplayReader::FindActor(uint32 ActorId) const
+{
+	const int32 Index = static_cast<int32>(ActorId) - 1;
+	return Actors.IsValidIndex(Index) && Actors[Index].Id == ActorId ? &Actors[Index] : nullptr;
+}
+
+/**
+ * The footer repeats the tables, so a seek lands with every class and actor already known.
+ */
+bool FNeonReplayReader::ReadFooter()
+{
+	FArchive& Ar = *Archive;
+
+	const int64 FileSize = StreamEnd;
+	if (FileSize < static_cast<int64>(sizeof(int64) + sizeof(uint32)))
+	{
+		return false;
+	}
+
+	int64 FooterOffset = 0;
+	uint32 Magic = 0;
+	Ar.Seek(FileSize - sizeof(int64) - sizeof(uint32));
+	Ar << FooterOffset << Magic;
+	if (Magic != FNeonReplayWriter::FooterMagic || FooterOffset <= 0 || FooterOffset >= FileSize)
+	{
+		return false;
+	}
+
+	Ar.Seek(FooterOffset);
+
+	uint8 Kind = 0;
+	Ar << Kind;
+	if (Kind != static_cast<uint8>(ENeonReplayRecord::Footer))
+	{
+		return false;
+	}
+
+	Ar << NumFrames << ClassPaths << Actors;
+
+	int32 NumIndexEntries = 0;
+	Ar << NumIndexEntries;
+	FrameIndex.SetNum(FMath::Max(NumIndexEntries, 0));
+	for (TPair<uint32, int64>& Entry : FrameIndex)
+	{
+		Ar << Entry.Key << Entry.Value;
+	}
+
+	if (Ar.IsError())
+	{
+		Ar.ClearError();
+		ClassPaths.Reset();
+		Actors.Reset();
+		FrameIndex.Reset();
+		NumFrames = 0;
+		return false;
+	}
+
+	StreamEnd = FooterOffset;
+	return true;
+}
+
+/**
+ * Grows the table to the id (stream records arrive in id order).
+ */
+void FNeonReplayReader::AddActor(const FNeonReplayActorInfo& Info)
+{
+	const int32 Index = static_cast<int32>(Info.Id) - 1;
+	if (Index < 0)
+	{
+		return;
+	}
+
+	if (Actors.Num() <= Index)
+	{
+		Actors.SetNum(Index + 1);
+	}
+	Actors[Index] = Info;
+}
\ No newline at end of file
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Forward declarations
+class AActor;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Record kinds in a combat replay file.
+ * Values are written to disk - append new kinds, never reorder.
+ */
+enum class ENeonReplayRecord : uint8
+{
+	/** Class table entry (index, path) - written the first time a class is referenced */
+	ClassDef,
+
+	/** Actor table entry (id, class, name, transform, player controlled) - written the first time an actor is referenced */
+	Actor,
+
+	/** Move input (actor, axis) */
+	Move,
+
+	/** Look input (actor, axis, resulting control rotation) */
+	Look,
+
+	/** Sprint pressed (actor) */
+	SprintStart,
+
+	/** Sprint released (actor) */
+	SprintStop,
+
+	/** Ability activated (actor, ability class) */
+	AbilityActivated,
+
+	/** Boomerang launched (owner, projectile class, launch transform, max distance) */
+	ProjectileSpawn,
+
+	/** Gameplay effect applied (source, target, effect class, level) */
+	EffectApplied,
+
+	/** End of a frame (delta time) */
+	FrameEnd,
+
+	/** Start of the footer (class table, actor table, frame index) - nothing follows it in the stream */
+	Footer
+};
+
+/**
+ * An actor referenced by a replay. Ids are assigned by the recorder, starting at 1 (0 = none).
+ */
+struct FNeonReplayActorInfo
+{
+	uint32 Id = 0;
+	int32 ClassIndex = INDEX_NONE;
+
+	/** Actor name in the recorded world (level-placed actors are matched by name on playback) */
+	FString Name;
+
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Driven by player input (playback gives it a controller if it has none) */
+	bool bPlayerControlled = false;
+
+	friend FArchive& operator<<(FArchive& Ar, FNeonReplayActorInfo& Info);
+};
+
+/**
+ * One decoded record. Which fields are meaningful depends on Kind.
+ */
+struct FNeonReplayRecord
+{
+	ENeonReplayRecord Kind = ENeonReplayRecord::FrameEnd;
+
+	/** Acting actor (input owner, projectile owner, effect source) */
+	uint32 ActorId = 0;
+
+	/** Effect target */
+	uint32 TargetId = 0;
+
+	/** Ability/projectile/effect class */
+	int32 ClassIndex = INDEX_NONE;
+
+	/** Move/Look axis */
+	FVector2D Axis = FVector2D::ZeroVector;
+
+	/** Launch location */
+	FVector Location = FVector::ZeroVector;
+
+	/** Launch rotation, control rotation after a Look */
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	/** Delta time (FrameEnd), max distance (ProjectileSpawn), level (EffectApplied) */
+	float Value = 0.f;
+
+	/** Actor records only */
+	FNeonReplayActorInfo Actor;
+};
+
+/**
+ * Writes a combat replay.
+ *
+ * Layout: header (magic, version, map name), a stream of records each starting with an ENeonReplayRecord byte,
+ * then on Close a footer with the class table, actor table and an index of frame offsets.
+ * Class and actor records also appear in the stream where they are first used, so a recording cut short by a
+ * crash (no footer) still plays back from the start.
+ */
+class PROJECT_SUNSET_API FNeonReplayWriter
+{
+public:
+	/** 'NRPL' */
+	static constexpr uint32 FileMagic = 0x4C50524E;
+
+	/** 'NRPF', last 4 bytes of a file with a footer */
+	static constexpr uint32 FooterMagic = 0x4650524E;
+
+	static constexpr uint32 FileVersion = 1;
+
+	/** A frame index entry is written every this many frames */
+	static constexpr uint32 IndexInterval = 60;
+
+	~FNeonReplayWriter();
+
+	/** Creates (or truncates) the file and writes the header */
+	bool Open(const FString& Path, const FString& MapName);
+
+	/** Writes the footer and closes the file */
+	void Close();
+
+	bool IsOpen() const { return Archive.IsValid(); }
+
+	/** Recorder id of an actor, writing its actor record on first use (0 for null) */
+	uint32 GetActorId(AActor* Actor, bool bPlayerControlled = false);
+
+	/** Class table index, writing its class record on first use (INDEX_NONE for null) */
+	int32 GetClassIndex(const UClass* Class);
+
+	/** Writes the record kind and returns the archive for the payload */
+	FArchive& BeginRecord(ENeonReplayRecord Kind);
+
+	/** Closes the current frame */
+	void EndFrame(float DeltaTime);
+
+	uint32 GetNumFrames() const { return NumFrames; }
+
+private:
+	TUniquePtr<FArchive> Archive;
+
+	TMap<const UClass*, int32> ClassIndices;
+	TArray<FString> ClassPaths;
+
+	TMap<TObjectKey<AActor>, uint32> ActorIds;
+	TArray<FNeonReplayActorInfo> Actors;
+
+	/** (frame, file offset of the frame's first record) every IndexInterval frames */
+	TArray<TPair<uint32, int64>> FrameIndex;
+
+	uint32 NumFrames = 0;
+};
+
+/**
+ * Reads a combat replay through a memory mapping of the whole file.
+ *
+ * Records are decoded straight out of the mapping, and the footer's frame index lets SeekToFrame jump to any
+ * frame without decoding what comes before it.
+ */
+class PROJECT_SUNSET_API FNeonReplayReader
+{
+public:
+	FNeonReplayReader();
+	~FNeonReplayReader();
+
+	/** Maps the file, checks the header and loads the footer if there is one */
+	bool Open(const FString& Path);
+
+	void Close();
+
+	/**
+	 * Decodes the next record. Class records are absorbed into the class table; actor records are
+	 * absorbed into the actor table and returned.
+	 *
+	 * @return False at the end of the stream
+	 */
+	bool ReadRecord(FNeonReplayRecord& OutRecord);
+
+	/**
+	 * Positions the stream at the start of a frame (the nearest indexed frame at or before it,
+	 * then skipping whole frames).
+	 *
+	 * @return False if the file has no footer or the frame is past the end
+	 */
+	bool SeekToFrame(uint32 Frame);
+
+	/** Frame the next record belongs to */
+	uint32 GetCurrentFrame() const { return CurrentFrame; }
+
+	/** Frames in the file (0 if there is no footer) */
+	uint32 GetNumFrames() const { return NumFrames; }
+
+	bool HasFooter() const { return bHasFooter; }
+
+	const FString& GetMapName() const { return MapName; }
+
+	/** Class path for a class index (empty if unknown) */
+	const FString& GetClassPath(int32 ClassIndex) const;
+
+	const TArray<FString>& GetClassPaths() const { return ClassPaths; }
+
+	/** Actor table entry for an id (null if unknown) */
+	const FNeonReplayActorInfo* FindActor(uint32 ActorId) const;
+
+private:
+	/** Reads the footer behind StreamEnd */
+	bool ReadFooter();
+
+	/** Stores an actor table entry by id */
+	void AddActor(const FNeonReplayActorInfo& Info);
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Reader over the mapped bytes */
+	TUniquePtr<FArchive> Archive;
+
+	/** Offset where the record stream ends (footer start, or file size without a footer) */
+	int64 StreamEnd = 0;
+
+	FString MapName;
+	TArray<FString> ClassPaths;
+	TArray<FNeonReplayActorInfo> Actors;
+	TArray<TPair<uint32, int64>> FrameIndex;
+
+	uint32 CurrentFrame = 0;
+	uint32 NumFrames = 0;
+	bool bHasFooter = false;
+};
\ No newline at end of file
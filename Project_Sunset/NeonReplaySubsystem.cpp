@@ -0,0 +1,704 @@
+#include "NeonReplaySubsystem.h"
+#include "PlayerCharacter.h"
+#include "NeonProjectile.h"
+#include "NeonProjectilePoolSubsystem.h"
+#include "NeonCombatLog.h"
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "GameplayEffect.h"
+#include "InputActionValue.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+
+/**
+ * Default recording path: Saved/Replays/Combat_<timestamp>.nrpl
+ */
+static FString MakeReplayPath()
+{
+	const FString Stamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Replays"), FString::Printf(TEXT("Combat_%s.nrpl"), *Stamp));
+}
+
+// ========================================
+// Recording
+// ========================================
+
+/**
+ * Playback and recording are exclusive; a running playback is left alone.
+ */
+bool UNeonReplaySubsystem::StartRecording(const FString& Path)
+{
+	if (Mode == ENeonReplayMode::Playback)
+	{
+		NEON_COMBAT_LOG(Warning, TEXT("Replay: can't record during playback"));
+		return false;
+	}
+
+	StopRecording();
+
+	if (!Writer.Open(Path, GetWorld()->GetMapName()))
+	{
+		return false;
+	}
+
+	Mode = ENeonReplayMode::Recording;
+	NEON_COMBAT_LOG(Log, TEXT("Replay: recording to %s"), *Path);
+	return true;
+}
+
+/**
+ * Safe to call while not recording.
+ */
+void UNeonReplaySubsystem::StopRecording()
+{
+	if (Mode != ENeonReplayMode::Recording)
+	{
+		return;
+	}
+
+	const uint32 NumFrames = Writer.GetNumFrames();
+	PendingLooks.Reset();
+	Writer.Close();
+	Mode = ENeonReplayMode::None;
+
+	NEON_COMBAT_LOG(Log, TEXT("Replay: recording stopped after %u frames"), NumFrames);
+}
+
+/**
+ * Recorded per handled input event, exactly as the character received it.
+ */
+void UNeonReplaySubsystem::RecordMove(APlayerCharacter* Character, const FVector2D& Axis)
+{
+	if (Mode == ENeonReplayMode::Recording)
+	{
+		uint32 Id = Writer.GetActorId(Character, true);
+		FVector2D Value = Axis;
+		Writer.BeginRecord(ENeonReplayRecord::Move) << Id << Value;
+	}
+}
+
+/**
+ * Held until the end of the frame: the player controller turns look input into rotation after the input handlers run.
+ */
+void UNeonReplaySubsystem::RecordLook(APlayerCharacter* Character, const FVector2D& Axis)
+{
+	if (Mode == ENeonReplayMode::Recording)
+	{
+		PendingLooks.FindOrAdd(Character) += Axis;
+	}
+}
+
+/**
+ * The control rotation is what playback applies - look input scaling lives in the player controller,
+ * which headless playback doesn't run. Written after the frame's moves, which used the previous rotation.
+ */
+void UNeonReplaySubsystem::FlushPendingLooks()
+{
+	for (const TPair<TWeakObjectPtr<APlayerCharacter>, FVector2D>& Look : PendingLooks)
+	{
+		if (APlayerCharacter* Character = Look.Key.Get())
+		{
+			uint32 Id = Writer.GetActorId(Character, true);
+			FVector2D Value = Look.Value;
+			FRotator ControlRotation = Character->GetControlRotation();
+			Writer.BeginRecord(ENeonReplayRecord::Look) << Id << Value << ControlRotation;
+		}
+	}
+
+	PendingLooks.Reset();
+}
+
+/**
+ * Start and stop are separate records.
+ */
+void UNeonReplaySubsystem::RecordSprint(APlayerCharacter* Character, bool bStarted)
+{
+	if (Mode == ENeonReplayMode::Recording)
+	{
+		uint32 Id = Writer.GetActorId(Character, true);
+		Writer.BeginRecord(bStarted ? ENeonReplayRecord::SprintStart : ENeonReplayRecord::SprintStop) << Id;
+	}
+}
+
+/**
+ * Playback re-activates the ability by class, which re-runs everything it does.
+ */
+void UNeonReplaySubsystem::RecordAbilityActivated(APlayerCharacter* Character, const UGameplayAbility* Ability)
+{
+	if (Mode == ENeonReplayMode::Recording && Ability)
+	{
+		uint32 Id = Writer.GetActorId(Character, Character->IsPlayerControlled());
+		int32 ClassIndex = Writer.GetClassIndex(Ability->GetClass());
+		Writer.BeginRecord(ENeonReplayRecord::AbilityActivated) << Id << ClassIndex;
+	}
+}
+
+/**
+ * A result: recorded, or counted against the recording during playback.
+ */
+void UNeonReplaySubsystem::RecordProjectileSpawn(const ANeonProjectile* Projectile, AActor* Owner, float MaxDistance)
+{
+	if (Mode == ENeonReplayMode::Recording)
+	{
+		uint32 OwnerId = Writer.GetActorId(Owner);
+		int32 ClassIndex = Writer.GetClassIndex(Projectile->GetClass());
+		FVector Location = Projectile->GetActorLocation();
+		FRotator Rotation = Projectile->GetActorRotation();
+		float Distance = MaxDistance;
+		Writer.BeginRecord(ENeonReplayRecord::ProjectileSpawn) << OwnerId << ClassIndex << Location << Rotation << Distance;
+	}
+	else if (Mode == ENeonReplayMode::Playback)
+	{
+		++ObservedSpawns;
+	}
+}
+
+/**
+ * A result: recorded, or counted against the recording during playback.
+ */
+void UNeonReplaySubsystem::RecordEffectApplied(AActor* Source, AActor* Target, const FGameplayEffectSpec& Spec)
+{
+	if (Mode == ENeonReplayMode::Recording)
+	{
+		uint32 SourceId = Writer.GetActorId(Source);
+		uint32 TargetId = Writer.GetActorId(Target);
+		int32 ClassIndex = Writer.GetClassIndex(Spec.Def ? Spec.Def->GetClass() : nullptr);
+		float Level = Spec.GetLevel();
+		Writer.BeginRecord(ENeonReplayRecord::EffectApplied) << SourceId << TargetId << ClassIndex << Level;
+	}
+	else if (Mode == ENeonReplayMode::Playback)
+	{
+		++ObservedEffects;
+	}
+}
+
+// ========================================
+// Playback
+// ========================================
+
+/**
+ * Loads every class the footer lists up front so playback never sync-loads mid-run.
+ * Frames start on the next tick.
+ */
+bool UNeonReplaySubsystem::StartPlayback(const FString& Path, bool bInReplaySpawns, bool bInQuitWhenDone)
+{
+	StopRecording();
+	StopPlayback();
+
+	if (!Reader.Open(Path))
+	{
+		NEON_COMBAT_LOG(Error, TEXT("Replay: %s is missing or not a combat replay"), *Path);
+		return false;
+	}
+
+	if (!Reader.HasFooter())
+	{
+		NEON_COMBAT_LOG(Warning, TEXT("Replay: %s has no footer (recording cut short) - classes load as they are reached"), *Path);
+	}
+
+	if (Reader.GetMapName() != GetWorld()->GetMapName())
+	{
+		NEON_COMBAT_LOG(Warning, TEXT("Replay: recorded on %s, playing on %s"), *Reader.GetMapName(), *GetWorld()->GetMapName());
+	}
+
+	PlaybackClasses.Reset();
+	for (int32 ClassIndex = 0; ClassIndex < Reader.GetClassPaths().Num(); ++ClassIndex)
+	{
+		ResolveClass(ClassIndex);
+	}
+
+	PlaybackActors.Reset();
+	PlaybackFrame = 0;
+	bPlaybackStarted = false;
+	bReplaySpawns = bInReplaySpawns;
+	bQuitWhenDone = bInQuitWhenDone;
+	ExpectedSpawns = ExpectedEffects = 0;
+	ObservedSpawns = ObservedEffects = 0;
+	FirstDivergentFrame = INDEX_NONE;
+	FrameTimes.Reset(Reader.GetNumFrames());
+
+	bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+
+	Mode = ENeonReplayMode::Playback;
+	NEON_COMBAT_LOG(Log, TEXT("Replay: playing %s (%u frames)"), *Path, Reader.GetNumFrames());
+	return true;
+}
+
+/**
+ * Safe to call while not playing back.
+ */
+void UNeonReplaySubsystem::StopPlayback()
+{
+	if (Mode == ENeonReplayMode::Playback)
+	{
+		FinishPlayback();
+	}
+}
+
+/**
+ * Records up to the next FrameEnd; its delta becomes the fixed timestep of the frame about to run.
+ */
+bool UNeonReplaySubsystem::ApplyNextFrame()
+{
+	FNeonReplayRecord Record;
+	while (Reader.ReadRecord(Record))
+	{
+		switch (Record.Kind)
+		{
+		case ENeonReplayRecord::Actor:
+			BindActor(Record.Actor);
+			break;
+
+		case ENeonReplayRecord::ProjectileSpawn:
+			++ExpectedSpawns;
+			if (bReplaySpawns)
+			{
+				ApplyInput(Record);
+			}
+			break;
+
+		case ENeonReplayRecord::EffectApplied:
+			++ExpectedEffects;
+			break;
+
+		case ENeonReplayRecord::FrameEnd:
+			FApp::SetFixedDeltaTime(Record.Value);
+			++PlaybackFrame;
+			return true;
+
+		default:
+			ApplyInput(Record);
+			break;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Inputs go through the character's own handlers, so playback exercises the same code as the recording.
+ */
+void UNeonReplaySubsystem::ApplyInput(const FNeonReplayRecord& Record)
+{
+	const TWeakObjectPtr<AActor>* Found = PlaybackActors.Find(Record.ActorId);
+	AActor* Actor = Found ? Found->Get() : nullptr;
+	APlayerCharacter* Character = Cast<APlayerCharacter>(Actor);
+
+	switch (Record.Kind)
+	{
+	case ENeonReplayRecord::Move:
+		if (Character)
+		{
+			Character->Move(FInputActionValue(Record.Axis));
+		}
+		break;
+
+	case ENeonReplayRecord::Look:
+		if (Character && Character->GetController())
+		{
+			Character->GetController()->SetControlRotation(Record.Rotation);
+		}
+		break;
+
+	case ENeonReplayRecord::SprintStart:
+	case ENeonReplayRecord::SprintStop:
+		if (Character && Record.Kind == ENeonReplayRecord::SprintStart)
+		{
+			Character->StartSprint();
+		}
+		else if (Character)
+		{
+			Character->StopSprint();
+		}
+		break;
+
+	case ENeonReplayRecord::AbilityActivated:
+		if (Character && Character->GetAbilitySystemComponent())
+		{
+			if (UClass* AbilityClass = ResolveClass(Record.ClassIndex))
+			{
+				Character->GetAbilitySystemComponent()->TryActivateAbilityByClass(AbilityClass);
+			}
+		}
+		break;
+
+	case ENeonReplayRecord::ProjectileSpawn:
+	{
+		UNeonProjectilePoolSubsystem* Pool = GetWorld()->GetSubsystem<UNeonProjectilePoolSubsystem>();
+		UClass* ProjectileClass = ResolveClass(Record.ClassIndex);
+		if (Pool && ProjectileClass && ProjectileClass->IsChildOf<ANeonProjectile>())
+		{
+			const FTransform LaunchTransform(Record.Rotation, Record.Location);
+			if (ANeonProjectile* Projectile = Pool->AcquireProjectile(ProjectileClass, LaunchTransform, Actor, Cast<APawn>(Actor)))
+			{
+				Projectile->InitializeBoomerang(Actor, Record.Value);
+			}
+		}
+		break;
+	}
+
+	default:
+		break;
+	}
+}
+
+/**
+ * Level actors keep their names between runs; anything else is spawned where the recording first saw it.
+ */
+void UNeonReplaySubsystem::BindActor(const FNeonReplayActorInfo& Info)
+{
+	UWorld* World = GetWorld();
+
+	AActor* Actor = FindObject<AActor>(World->PersistentLevel, *Info.Name);
+	if (!Actor)
+	{
+		UClass* ActorClass = ResolveClass(Info.ClassIndex);
+		if (!ActorClass || !ActorClass->IsChildOf<AActor>() || ActorClass->IsChildOf<ANeonProjectile>())
+		{
+			// Projectiles come from the pool (or from abilities), never from the actor table
+			return;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		Actor = World->SpawnActor<AActor>(ActorClass, Info.Location, Info.Rotation, SpawnParams);
+	}
+
+	APawn* Pawn = Cast<APawn>(Actor);
+	if (Pawn && Info.bPlayerControlled && !Pawn->GetController())
+	{
+		// Movement input and control rotation need a controller. A player controller without a player never
+		// runs PlayerTick, so nothing overwrites the recorded control rotation (an AI controller would).
+		if (APlayerController* Controller = World->SpawnActor<APlayerController>())
+		{
+			Controller->Possess(Pawn);
+		}
+	}
+
+	if (Actor)
+	{
+		PlaybackActors.Add(Info.Id, Actor);
+	}
+}
+
+/**
+ * Playback is not a gameplay hot path - classes missing from the footer are loaded synchronously once.
+ */
+UClass* UNeonReplaySubsystem::ResolveClass(int32 ClassIndex)
+{
+	if (ClassIndex < 0)
+	{
+		return nullptr;
+	}
+
+	if (PlaybackClasses.IsValidIndex(ClassIndex) && PlaybackClasses[ClassIndex])
+	{
+		return PlaybackClasses[ClassIndex];
+	}
+
+	const FString& Path = Reader.GetClassPath(ClassIndex);
+	UClass* Class = Path.IsEmpty() ? nullptr : LoadClass<UObject>(nullptr, *Path);
+	if (!Class)
+	{
+		NEON_COMBAT_LOG(Warning, TEXT("Replay: could not load class %s"), *Path);
+		return nullptr;
+	}
+
+	if (PlaybackClasses.Num() <= ClassIndex)
+	{
+		PlaybackClasses.SetNum(ClassIndex + 1);
+	}
+	PlaybackClasses[ClassIndex] = Class;
+	return Class;
+}
+
+/**
+ * Frame time percentiles plus the result check, then back to the game's own timestep.
+ */
+void UNeonReplaySubsystem::FinishPlayback()
+{
+	const bool bDiverged = FirstDivergentFrame != INDEX_NONE || ExpectedSpawns != ObservedSpawns || ExpectedEffects != ObservedEffects;
+
+	double MeanMs = 0.0;
+	double P99Ms = 0.0;
+	double MaxMs = 0.0;
+	if (FrameTimes.Num() > 0)
+	{
+		FrameTimes.Sort();
+		for (double Time : FrameTimes)
+		{
+			MeanMs += Time;
+		}
+		MeanMs = MeanMs * 1000.0 / FrameTimes.Num();
+		P99Ms = FrameTimes[FMath::Min(FrameTimes.Num() - 1, FMath::FloorToInt32(FrameTimes.Num() * 0.99))] * 1000.0;
+		MaxMs = FrameTimes.Last() * 1000.0;
+	}
+
+	UE_LOG(LogNeonBench, Display, TEXT("Replay: %u frames, mean %.3f ms, p99 %.3f ms, max %.3f ms"),
+		PlaybackFrame, MeanMs, P99Ms, MaxMs);
+	UE_LOG(LogNeonBench, Display, TEXT("Replay: launches %llu/%llu, effects %llu/%llu (observed/recorded) - %s"),
+		ObservedSpawns, ExpectedSpawns, ObservedEffects, ExpectedEffects,
+		bDiverged ? TEXT("DIVERGED") : TEXT("match"));
+	if (FirstDivergentFrame != INDEX_NONE)
+	{
+		UE_LOG(LogNeonBench, Display, TEXT("Replay: first divergence at frame %lld"), FirstDivergentFrame);
+	}
+
+	FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+
+	Reader.Close();
+	PlaybackActors.Reset();
+	PlaybackClasses.Reset();
+	Mode = ENeonReplayMode::None;
+
+	if (bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bDiverged ? 1 : 0);
+	}
+}
+
+// ========================================
+// Tick
+// ========================================
+
+/**
+ * Nothing to do while idle.
+ */
+bool UNeonReplaySubsystem::IsTickable() const
+{
+	return Mode != ENeonReplayMode::None;
+}
+
+/**
+ * Runs after the frame's actors: recording closes the frame; playback checks the frame that just ran,
+ * then applies the inputs of the next one.
+ */
+void UNeonReplaySubsystem::Tick(float DeltaTime)
+{
+	if (Mode == ENeonReplayMode::Recording)
+	{
+		FlushPendingLooks();
+		Writer.EndFrame(DeltaTime);
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (bPlaybackStarted)
+	{
+		FrameTimes.Add(Now - LastFrameTime);
+
+		if (FirstDivergentFrame == INDEX_NONE && (ObservedSpawns != ExpectedSpawns || ObservedEffects != ExpectedEffects))
+		{
+			FirstDivergentFrame = PlaybackFrame;
+		}
+	}
+	LastFrameTime = Now;
+	bPlaybackStarted = true;
+
+	if (!ApplyNextFrame())
+	{
+		FinishPlayback();
+	}
+}
+
+TStatId UNeonReplaySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNeonReplaySubsystem, STATGROUP_Tickables);
+}
+
+// ========================================
+// Lifetime
+// ========================================
+
+/**
+ * Command line entry points, so production sessions can record and CI can play back headlessly.
+ */
+void UNeonReplaySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FString Path;
+	if (FParse::Value(FCommandLine::Get(), TEXT("NeonReplayPlay="), Path))
+	{
+		StartPlayback(Path, FParse::Param(FCommandLine::Get(), TEXT("NeonReplaySpawns")), FParse::Param(FCommandLine::Get(), TEXT("NeonReplayQuit")));
+	}
+	else if (FParse::Value(FCommandLine::Get(), TEXT("NeonReplayRecord="), Path))
+	{
+		StartRecording(Path);
+	}
+}
+
+/**
+ * Finishes the recording so it gets its footer; ends playback with a report.
+ */
+void UNeonReplaySubsystem::Deinitialize()
+{
+	StopRecording();
+	StopPlayback();
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds record or play back.
+ */
+bool UNeonReplaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ========================================
+// Console Commands
+// ========================================
+
+namespace NeonReplayCommands
+{
+	/** Subsystem of the command's world, logging an error if there is none */
+	static UNeonReplaySubsystem* GetSubsystem(UWorld* World)
+	{
+		UNeonReplaySubsystem* Replay = World ? World->GetSubsystem<UNeonReplaySubsystem>() : nullptr;
+		if (!Replay)
+		{
+			NEON_COMBAT_LOG(Error, TEXT("Replay: needs a game world (run with -game or in PIE)"));
+		}
+		return Replay;
+	}
+
+	/**
+	 * neon.Replay.Record [File]
+	 */
+	static FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("neon.Replay.Record"),
+		TEXT("Records combat inputs and results to a replay file. Args: [File] (default Saved/Replays/Combat_<time>.nrpl)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UNeonReplaySubsystem* Replay = GetSubsystem(World))
+			{
+				const FString Path = Args.Num() > 0 ? Args[0] : MakeReplayPath();
+				if (!Replay->StartRecording(Path))
+				{
+					NEON_COMBAT_LOG(Error, TEXT("Replay: failed to create %s"), *Path);
+				}
+			}
+		})
+	);
+
+	/**
+	 * neon.Replay.Stop
+	 */
+	static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+		TEXT("neon.Replay.Stop"),
+		TEXT("Stops the running recording or playback."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (UNeonReplaySubsystem* Replay = GetSubsystem(World))
+			{
+				Replay->StopRecording();
+				Replay->StopPlayback();
+			}
+		})
+	);
+
+	/**
+	 * neon.Replay.Play File [Spawns] [Quit]
+	 */
+	static FAutoConsoleCommandWithWorldAndArgs PlayCommand(
+		TEXT("neon.Replay.Play"),
+		TEXT("Plays a replay in this world on the recorded timestep and reports frame times and divergence. ")
+		TEXT("Args: File, Spawns (re-launch recorded boomerangs), Quit (exit when done, code 1 on divergence)."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UNeonReplaySubsystem* Replay = GetSubsystem(World);
+			if (!Replay || Args.Num() == 0)
+			{
+				return;
+			}
+
+			Replay->StartPlayback(Args[0], Args.Contains(TEXT("Spawns")), Args.Contains(TEXT("Quit")));
+		})
+	);
+
+	/**
+	 * neon.Replay.Dump File [From=Frame] [Frames=N]
+	 */
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("neon.Replay.Dump"),
+		TEXT("Prints the records of a replay file. Args: File, From=Frame (seeks through the frame index), Frames=N (default 1)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			if (Args.Num() == 0)
+			{
+				return;
+			}
+
+			uint32 FromFrame = 0;
+			uint32 NumFrames = 1;
+			for (const FString& Arg : Args)
+			{
+				FParse::Value(*Arg, TEXT("From="), FromFrame);
+				FParse::Value(*Arg, TEXT("Frames="), NumFrames);
+			}
+
+			FNeonReplayReader DumpReader;
+			if (!DumpReader.Open(Args[0]))
+			{
+				NEON_COMBAT_LOG(Error, TEXT("Replay: %s is missing or not a combat replay"), *Args[0]);
+				return;
+			}
+
+			if (FromFrame > 0 && !DumpReader.SeekToFrame(FromFrame))
+			{
+				NEON_COMBAT_LOG(Error, TEXT("Replay: can't seek to frame %u (%u frames, footer %s)"),
+					FromFrame, DumpReader.GetNumFrames(), DumpReader.HasFooter() ? TEXT("present") : TEXT("missing"));
+				return;
+			}
+
+			UE_LOG(LogNeonCombat, Display, TEXT("Replay %s: map %s, %u frames"), *Args[0], *DumpReader.GetMapName(), DumpReader.GetNumFrames());
+
+			FNeonReplayRecord Record;
+			while (DumpReader.GetCurrentFrame() < FromFrame + NumFrames && DumpReader.ReadRecord(Record))
+			{
+				const uint32 Frame = Record.Kind == ENeonReplayRecord::FrameEnd ? DumpReader.GetCurrentFrame() - 1 : DumpReader.GetCurrentFrame();
+				switch (Record.Kind)
+				{
+				case ENeonReplayRecord::Actor:
+					UE_LOG(LogNeonCombat, Display, TEXT("[%u] Actor %u = %s"), Frame, Record.ActorId, *Record.Actor.Name);
+					break;
+				case ENeonReplayRecord::Move:
+				case ENeonReplayRecord::Look:
+					UE_LOG(LogNeonCombat, Display, TEXT("[%u] %s %u (%.2f, %.2f)"), Frame,
+						Record.Kind == ENeonReplayRecord::Move ? TEXT("Move") : TEXT("Look"), Record.ActorId, Record.Axis.X, Record.Axis.Y);
+					break;
+				case ENeonReplayRecord::SprintStart:
+				case ENeonReplayRecord::SprintStop:
+					UE_LOG(LogNeonCombat, Display, TEXT("[%u] %s %u"), Frame,
+						Record.Kind == ENeonReplayRecord::SprintStart ? TEXT("SprintStart") : TEXT("SprintStop"), Record.ActorId);
+					break;
+				case ENeonReplayRecord::AbilityActivated:
+					UE_LOG(LogNeonCombat, Display, TEXT("[%u] Ability %u %s"), Frame, Record.ActorId, *DumpReader.GetClassPath(Record.ClassIndex));
+					break;
+				case ENeonReplayRecord::ProjectileSpawn:
+					UE_LOG(LogNeonCombat, Display, TEXT("[%u] Launch %u %s at %s, distance %.0f"), Frame, Record.ActorId,
+						*DumpReader.GetClassPath(Record.ClassIndex), *Record.Location.ToString(), Record.Value);
+					break;
+				case ENeonReplayRecord::EffectApplied:
+					UE_LOG(LogNeonCombat, Display, TEXT("[%u] Effect %u -> %u %s (level %.0f)"), Frame, Record.ActorId, Record.TargetId,
+						*DumpReader.GetClassPath(Record.ClassIndex), Record.Value);
+					break;
+				case ENeonReplayRecord::FrameEnd:
+					UE_LOG(LogNeonCombat, Display, TEXT("[%u] FrameEnd %.4f"), Frame, Record.Value);
+					break;
+				default:
+					break;
+				}
+			}
+		})
+	);
+}
\ No newline at end of file
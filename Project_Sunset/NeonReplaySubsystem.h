@@ -0,0 +1,181 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonReplayFormat.h"
+#include "NeonReplaySubsystem.generated.h"
+
+// Forward declarations
+class APlayerCharacter;
+class ANeonProjectile;
+class UGameplayAbility;
+struct FGameplayEffectSpec;
+
+/**
+ * What the replay subsystem is doing in this world.
+ */
+enum class ENeonReplayMode : uint8
+{
+	None,
+	Recording,
+	Playback
+};
+
+/**
+ * Records combat into a compact binary replay and plays it back headlessly.
+ *
+ * Recording captures player inputs (Move, Look, sprint), ability activations, and the results they led to
+ * (boomerang launches, gameplay effect applications), one FrameEnd record per frame.
+ *
+ * Playback memory-maps the file, drives the same world from the recorded inputs on a fixed timestep matching the
+ * recorded frame times, and checks the results against the recording: the first frame where the launches or
+ * applied effects stop matching is reported as a divergence. Frame times are reported like the stress benchmark,
+ * so any captured fight is a repeatable benchmark and a regression test.
+ *
+ *   Record:  -NeonReplayRecord=Path on the command line, or neon.Replay.Record [File] / neon.Replay.Stop
+ *   Play:    UnrealEditor-Cmd Project_Sunset.uproject <Map> -game -nullrhi -unattended -NeonReplayPlay=Path -NeonReplayQuit
+ *   Inspect: neon.Replay.Dump File [From=Frame] [Frames=N]
+ *
+ * The process exit code of a -NeonReplayQuit run is 1 if playback diverged.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonReplaySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Starts recording to Path (replaces a running recording) */
+	bool StartRecording(const FString& Path);
+
+	/** Writes the footer and closes the recording */
+	void StopRecording();
+
+	/**
+	 * Starts driving this world from a recording.
+	 *
+	 * @param Path - Replay file
+	 * @param bReplaySpawns - Re-launch recorded boomerangs instead of only checking them (for recordings where
+	 *                        projectiles were fired by code rather than abilities, e.g. the stress benchmark)
+	 * @param bQuitWhenDone - Exit when playback finishes (exit code 1 on divergence)
+	 */
+	bool StartPlayback(const FString& Path, bool bReplaySpawns, bool bQuitWhenDone);
+
+	/** Ends playback early and reports what ran so far */
+	void StopPlayback();
+
+	ENeonReplayMode GetMode() const { return Mode; }
+
+	bool IsRecording() const { return Mode == ENeonReplayMode::Recording; }
+
+	// ========================================
+	// Hooks (cheap no-ops unless recording or playing back)
+	// ========================================
+
+	/** Move input handled by a character */
+	void RecordMove(APlayerCharacter* Character, const FVector2D& Axis);
+
+	/** Look input handled by a character (summed per frame, written with the frame's final control rotation) */
+	void RecordLook(APlayerCharacter* Character, const FVector2D& Axis);
+
+	/** Sprint started or stopped */
+	void RecordSprint(APlayerCharacter* Character, bool bStarted);
+
+	/** Ability activated on a character's ASC */
+	void RecordAbilityActivated(APlayerCharacter* Character, const UGameplayAbility* Ability);
+
+	/** Boomerang initialized (recorded when recording, counted when playing back) */
+	void RecordProjectileSpawn(const ANeonProjectile* Projectile, AActor* Owner, float MaxDistance);
+
+	/** Effect applied to a target (recorded when recording, counted when playing back) */
+	void RecordEffectApplied(AActor* Source, AActor* Target, const FGameplayEffectSpec& Spec);
+
+	// ========================================
+	// FTickableGameObject Interface
+	// ========================================
+
+	/** Only ticks while recording or playing back */
+	virtual bool IsTickable() const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// USubsystem Interface
+	// ========================================
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds record or play back */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Applies the next frame's records; false at the end of the replay */
+	bool ApplyNextFrame();
+
+	/** Applies one input record to its actor */
+	void ApplyInput(const FNeonReplayRecord& Record);
+
+	/** Binds a recorded actor to one in this world (level actor with the same name, or a new spawn) */
+	void BindActor(const FNeonReplayActorInfo& Info);
+
+	/** Loaded class for a class index (loaded once, cached) */
+	UClass* ResolveClass(int32 ClassIndex);
+
+	/** Logs the summary, restores the timestep and optionally exits */
+	void FinishPlayback();
+
+	ENeonReplayMode Mode = ENeonReplayMode::None;
+
+	// ========================================
+	// Recording
+	// ========================================
+
+	FNeonReplayWriter Writer;
+
+	/** Look input per character this frame (the control rotation it produces is only known at the end of the frame) */
+	TMap<TWeakObjectPtr<APlayerCharacter>, FVector2D> PendingLooks;
+
+	/** Writes PendingLooks with each character's control rotation */
+	void FlushPendingLooks();
+
+	// ========================================
+	// Playback
+	// ========================================
+
+	FNeonReplayReader Reader;
+
+	/** Playback actors by recorded id */
+	TMap<uint32, TWeakObjectPtr<AActor>> PlaybackActors;
+
+	/** Loaded classes by class index (strong refs: abilities/effects must stay loaded for the whole run) */
+	UPROPERTY(Transient)
+	TArray<UClass*> PlaybackClasses;
+
+	/** Frame whose inputs were applied last */
+	uint32 PlaybackFrame = 0;
+
+	/** Whether the first frame has been applied */
+	bool bPlaybackStarted = false;
+
+	bool bReplaySpawns = false;
+	bool bQuitWhenDone = false;
+
+	/** Results in the recording up to PlaybackFrame */
+	uint64 ExpectedSpawns = 0;
+	uint64 ExpectedEffects = 0;
+
+	/** Results seen during playback */
+	uint64 ObservedSpawns = 0;
+	uint64 ObservedEffects = 0;
+
+	/** First frame whose totals didn't match, INDEX_NONE while playback matches */
+	int64 FirstDivergentFrame = INDEX_NONE;
+
+	/** Wall time per played frame */
+	TArray<double> FrameTimes;
+	double LastFrameTime = 0.0;
+
+	bool bPrevUseFixedTimeStep = false;
+	double PrevFixedDeltaTime = 0.0;
+};
\ No newline at end of file
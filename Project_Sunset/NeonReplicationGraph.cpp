@@ -0,0 +1,253 @@
+#include "NeonReplicationGraph.h"
+#include "NeonProjectile.h"
+#include "EnemyCharacter.h"
+#include "NeonCombatStats.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerState.h"
+
+// ========================================
+// Setup
+// ========================================
+
+/**
+ * Update rates are stored as a frame period at the server tick rate, so 20 Hz on a 60 Hz server replicates every 3rd frame.
+ */
+void UNeonReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	SetClassSettings(AEnemyCharacter::StaticClass(), EnemyUpdateFrequency, EnemyCullDistance);
+	SetClassSettings(ANeonProjectile::StaticClass(), ProjectileUpdateFrequency, ProjectileCullDistance);
+	SetClassSettings(APlayerCharacter::StaticClass(), PlayerPawnUpdateFrequency, 0.f);
+	SetClassSettings(APlayerState::StaticClass(), PlayerStateUpdateFrequency, 0.f);
+}
+
+/**
+ * One grid for everything that moves, one list for projectiles, one list for everything relevant to everyone.
+ */
+void UNeonReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = GridSpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	ProjectileNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(ProjectileNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+/**
+ * The per-connection node always gathers the connection's controller, pawn and view target.
+ */
+void UNeonReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager)
+{
+	Super::InitConnectionGraphNodes(ConnectionManager);
+
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(ConnectionNode, ConnectionManager);
+	ConnectionNodes.Emplace(ConnectionManager->NetConnection, ConnectionNode);
+}
+
+// ========================================
+// Routing
+// ========================================
+
+/**
+ * Relevancy flags decide first (game state and player states are always relevant), then projectiles get their own list;
+ * everything else with a location is spatialized.
+ */
+ENeonRepNodeMapping UNeonReplicationGraph::GetMappingPolicy(const AActor* Actor) const
+{
+	if (Actor->bAlwaysRelevant)
+	{
+		return ENeonRepNodeMapping::RelevantAllConnections;
+	}
+
+	if (Actor->bOnlyRelevantToOwner)
+	{
+		return ENeonRepNodeMapping::RelevantOwnerConnection;
+	}
+
+	if (Actor->IsA<ANeonProjectile>())
+	{
+		return ENeonRepNodeMapping::Projectile;
+	}
+
+	// Actors with no location (info actors, managers) can't be spatialized
+	if (!Actor->GetRootComponent())
+	{
+		return ENeonRepNodeMapping::RelevantAllConnections;
+	}
+
+	return ENeonRepNodeMapping::SpatializeDynamic;
+}
+
+/**
+ * Places a newly replicated actor in its node.
+ */
+void UNeonReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Actor))
+	{
+	case ENeonRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	case ENeonRepNodeMapping::RelevantOwnerConnection:
+		if (UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = FindConnectionNode(ActorInfo.Actor->GetNetConnection()))
+		{
+			ConnectionNode->NotifyAddNetworkActor(ActorInfo);
+		}
+		else
+		{
+			ActorsWithoutConnection.Add(ActorInfo.Actor);
+		}
+		break;
+
+	case ENeonRepNodeMapping::SpatializeDynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+
+	case ENeonRepNodeMapping::Projectile:
+		ProjectileNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	}
+}
+
+/**
+ * Mirror of RouteAddNetworkActorToNodes.
+ */
+void UNeonReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Actor))
+	{
+	case ENeonRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	case ENeonRepNodeMapping::RelevantOwnerConnection:
+		if (ActorsWithoutConnection.RemoveSingleSwap(ActorInfo.Actor, EAllowShrinking::No) == 0)
+		{
+			// The owner may have changed since it was added - check every connection
+			for (const TPair<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*>& Pair : ConnectionNodes)
+			{
+				Pair.Value->NotifyRemoveNetworkActor(ActorInfo, false);
+			}
+		}
+		break;
+
+	case ENeonRepNodeMapping::SpatializeDynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+
+	case ENeonRepNodeMapping::Projectile:
+		ProjectileNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	}
+}
+
+/**
+ * Drops the connection's node from the lookup; the graph destroys the node itself.
+ */
+void UNeonReplicationGraph::RemoveClientConnection(UNetConnection* NetConnection)
+{
+	ConnectionNodes.RemoveAllSwap([NetConnection](const TPair<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*>& Pair)
+	{
+		return Pair.Key == NetConnection;
+	});
+
+	Super::RemoveClientConnection(NetConnection);
+}
+
+/**
+ * Linear search - there are only as many entries as players.
+ */
+UReplicationGraphNode_AlwaysRelevant_ForConnection* UNeonReplicationGraph::FindConnectionNode(const UNetConnection* NetConnection) const
+{
+	if (!NetConnection)
+	{
+		return nullptr;
+	}
+
+	for (const TPair<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*>& Pair : ConnectionNodes)
+	{
+		if (Pair.Key == NetConnection)
+		{
+			return Pair.Value;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Owner-only actors usually get their connection a few frames after spawning (possession, SetOwner).
+ */
+void UNeonReplicationGraph::RouteActorsWithoutConnection()
+{
+	for (int32 Index = ActorsWithoutConnection.Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Actor = ActorsWithoutConnection[Index];
+		if (!IsValid(Actor))
+		{
+			ActorsWithoutConnection.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (UReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = FindConnectionNode(Actor->GetNetConnection()))
+		{
+			ConnectionNode->NotifyAddNetworkActor(FNewReplicatedActorInfo(Actor));
+			ActorsWithoutConnection.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+}
+
+// ========================================
+// Replication
+// ========================================
+
+/**
+ * Times the whole server replication pass (gather, prioritize, serialize) for stat NeonCombat and the benchmark.
+ */
+int32 UNeonReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	NEON_COMBAT_SCOPE(STAT_NeonServerReplicateActors);
+
+#if !UE_BUILD_SHIPPING
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+#endif
+
+	if (ActorsWithoutConnection.Num() > 0)
+	{
+		RouteActorsWithoutConnection();
+	}
+
+	const int32 Result = Super::ServerReplicateActors(DeltaSeconds);
+
+#if !UE_BUILD_SHIPPING
+	FNeonCombatCounters::ServerReplicateCycles += FPlatformTime::Cycles64() - StartCycles;
+#endif
+
+	return Result;
+}
+
+/**
+ * Frequency becomes a frame period at the server tick rate (at least every frame, at most every 255th).
+ */
+void UNeonReplicationGraph::SetClassSettings(UClass* Class, float UpdateFrequency, float CullDistance)
+{
+	const AActor* ClassDefault = GetDefault<AActor>(Class);
+
+	FClassReplicationInfo ClassInfo;
+
+	const float ServerTickRate = static_cast<float>(NetDriver->GetNetServerMaxTickRate());
+	ClassInfo.ReplicationPeriodFrame = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt32(ServerTickRate / FMath::Max(UpdateFrequency, 0.01f)), 1, MAX_uint8));
+
+	ClassInfo.SetCullDistanceSquared(CullDistance > 0.f ? FMath::Square(CullDistance) : ClassDefault->GetNetCullDistanceSquared());
+
+	GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+}
\ No newline at end of file
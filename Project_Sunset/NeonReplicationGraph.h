@@ -0,0 +1,133 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "NeonReplicationGraph.generated.h"
+
+// Forward declarations
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+
+/**
+ * How an actor is routed into the graph. Decided once per actor when it is added.
+ */
+enum class ENeonRepNodeMapping : uint8
+{
+	/** Replicated to every connection (game state, player states) */
+	RelevantAllConnections,
+
+	/** Only relevant to the owning connection (added to that connection's node) */
+	RelevantOwnerConnection,
+
+	/** Moving actors in the spatial grid, re-bucketed every frame (enemies, player pawns) */
+	SpatializeDynamic,
+
+	/** Projectiles: one flat list gathered for every connection, culled per connection by distance */
+	Projectile
+};
+
+/**
+ * Replication graph for the game net driver.
+ *
+ * The default net driver checks every replicated actor against every connection each net tick,
+ * so server cost grows with actors x connections. The graph instead gathers a short list per connection:
+ * - A 2D spatial grid holds enemies and player pawns; a connection only considers the cells around its viewer
+ * - Projectiles live in their own flat list. They are pooled and short-lived, so in the grid every pooled projectile
+ *   (parked ones included) would be re-bucketed each frame and hop cells several times per flight. The list costs a swap to
+ *   add or remove, and the graph's per-connection cull distance and dormancy checks do the rest
+ * - Game state and player states sit in one always-relevant list
+ * - Each connection has a node with its own controller, pawn and view target, plus any owner-only actors
+ *
+ * Projectiles and enemies get their own cull distances and update rates (in frames at the server tick rate).
+ *
+ * Bound to the game net driver in the module startup (neon.Net.ReplicationGraph=0 falls back to the default driver).
+ * Settings are read from the [/Script/Project_Sunset.NeonReplicationGraph] section of Game.ini.
+ */
+UCLASS(Transient, Config = Game)
+class PROJECT_SUNSET_API UNeonReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================
+	// UReplicationGraph Interface
+	// ========================================
+
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual void RemoveClientConnection(UNetConnection* NetConnection) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+protected:
+	// ========================================
+	// Configuration
+	// ========================================
+
+	/** Grid cell size (cm). Roughly the largest cull distance keeps gathers to a few cells */
+	UPROPERTY(Config)
+	float GridCellSize = 10000.f;
+
+	/** Grid origin offset; the grid only covers positive coordinates from here */
+	UPROPERTY(Config)
+	FVector2D GridSpatialBias = FVector2D(-200000.f, -200000.f);
+
+	/** Enemies further than this from a connection's viewer don't replicate to it */
+	UPROPERTY(Config)
+	float EnemyCullDistance = 15000.f;
+
+	/** Enemy updates per second */
+	UPROPERTY(Config)
+	float EnemyUpdateFrequency = 20.f;
+
+	/** Projectiles further than this from a connection's viewer don't replicate to it */
+	UPROPERTY(Config)
+	float ProjectileCullDistance = 8000.f;
+
+	/** Projectile updates per second */
+	UPROPERTY(Config)
+	float ProjectileUpdateFrequency = 30.f;
+
+	/** Player pawn updates per second (other players' pawns; your own is in your connection node) */
+	UPROPERTY(Config)
+	float PlayerPawnUpdateFrequency = 60.f;
+
+	/** Player state updates per second (score, name - rarely changes) */
+	UPROPERTY(Config)
+	float PlayerStateUpdateFrequency = 2.f;
+
+private:
+	/** Where an actor of this class goes in the graph */
+	ENeonRepNodeMapping GetMappingPolicy(const AActor* Actor) const;
+
+	/** Registers a class's update period and cull distance (0 = use the CDO's NetCullDistanceSquared) */
+	void SetClassSettings(UClass* Class, float UpdateFrequency, float CullDistance);
+
+	/** Per-connection node for a connection, or nullptr if it hasn't been created yet */
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* FindConnectionNode(const UNetConnection* NetConnection) const;
+
+	/** Moves owner-only actors whose owner now has a connection into that connection's node */
+	void RouteActorsWithoutConnection();
+
+	/** Spatial grid for moving actors */
+	UPROPERTY()
+	UReplicationGraphNode_GridSpatialization2D* GridNode = nullptr;
+
+	/** Every replicated projectile (gathered for all connections, culled by ProjectileCullDistance) */
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* ProjectileNode = nullptr;
+
+	/** Actors relevant to every connection */
+	UPROPERTY()
+	UReplicationGraphNode_ActorList* AlwaysRelevantNode = nullptr;
+
+	/** Per-connection node, by connection (swap-removed on disconnect) */
+	TArray<TPair<UNetConnection*, UReplicationGraphNode_AlwaysRelevant_ForConnection*>> ConnectionNodes;
+
+	/** Owner-only actors added before their owner had a connection (e.g. a pawn before possession) */
+	UPROPERTY()
+	TArray<AActor*> ActorsWithoutConnection;
+};
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include "NeonSignificanceSubsystem.h"
+#include "EnemyCharacter.h"
+#include "NeonCombatStats.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+/**
+ * Default bucket rates. High is full rate; Low ticks about 4 times a second and only animates on screen.
+ */
+UNeonSignificanceSubsystem::UNeonSignificanceSubsystem()
+{
+	FNeonSignificanceBucketSettings& Medium = Buckets[static_cast<int32>(ENeonSignificanceLOD::Medium)];
+	Medium.ActorTickInterval = 0.1f;
+	Medium.MovementTickInterval = 1.f / 30.f;
+	Medium.AnimationTickInterval = 1.f / 30.f;
+
+	FNeonSignificanceBucketSettings& Low = Buckets[static_cast<int32>(ENeonSignificanceLOD::Low)];
+	Low.ActorTickInterval = 0.25f;
+	Low.MovementTickInterval = 0.1f;
+	Low.AnimationTickInterval = 0.1f;
+	Low.bOnlyAnimateWhenRendered = true;
+	Low.bDeferAttributeEvents = true;
+}
+
+// ========================================
+// Registration
+// ========================================
+
+/**
+ * New enemies start at full rate; the next scoring pass moves them to their real bucket.
+ */
+void UNeonSignificanceSubsystem::RegisterEnemy(AEnemyCharacter* Enemy)
+{
+	if (!Enemy || Enemies.Contains(Enemy))
+	{
+		return;
+	}
+
+	Enemies.Add(Enemy);
+	Enemy->ApplySignificanceLOD(ENeonSignificanceLOD::High, GetBucketSettings(ENeonSignificanceLOD::High));
+	++BucketCounts[static_cast<int32>(ENeonSignificanceLOD::High)];
+}
+
+/**
+ * Swap-removes the enemy; order doesn't matter to scoring.
+ */
+void UNeonSignificanceSubsystem::UnregisterEnemy(AEnemyCharacter* Enemy)
+{
+	const int32 Index = Enemies.IndexOfByKey(Enemy);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	--BucketCounts[static_cast<int32>(Enemy->GetSignificanceLOD())];
+	Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+/**
+ * Counts are refreshed by each scoring pass.
+ */
+int32 UNeonSignificanceSubsystem::GetNumEnemiesInBucket(ENeonSignificanceLOD LOD) const
+{
+	return BucketCounts[static_cast<int32>(LOD)];
+}
+
+/**
+ * Config rates for a bucket.
+ */
+const FNeonSignificanceBucketSettings& UNeonSignificanceSubsystem::GetBucketSettings(ENeonSignificanceLOD LOD) const
+{
+	return Buckets[static_cast<int32>(LOD)];
+}
+
+// ========================================
+// Scoring
+// ========================================
+
+/**
+ * Rescores every enemy a few times per second and applies bucket changes.
+ */
+void UNeonSignificanceSubsystem::Tick(float DeltaTime)
+{
+	TimeUntilUpdate -= DeltaTime;
+	if (TimeUntilUpdate > 0.f || Enemies.Num() == 0)
+	{
+		return;
+	}
+	TimeUntilUpdate = UpdateInterval;
+
+	NEON_COMBAT_SCOPE(STAT_NeonSignificanceUpdate);
+
+	GatherViewers();
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	FMemory::Memzero(BucketCounts);
+
+	for (int32 Index = Enemies.Num() - 1; Index >= 0; --Index)
+	{
+		AEnemyCharacter* Enemy = Enemies[Index].Get();
+		if (!Enemy)
+		{
+			// Destroyed without EndPlay (e.g. world teardown order)
+			Enemies.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const ENeonSignificanceLOD LOD = ScoreEnemy(Enemy, CurrentTime);
+		if (LOD != Enemy->GetSignificanceLOD())
+		{
+			Enemy->ApplySignificanceLOD(LOD, GetBucketSettings(LOD));
+		}
+
+		++BucketCounts[static_cast<int32>(LOD)];
+	}
+
+	SET_DWORD_STAT(STAT_NeonEnemiesHigh, BucketCounts[static_cast<int32>(ENeonSignificanceLOD::High)]);
+	SET_DWORD_STAT(STAT_NeonEnemiesMedium, BucketCounts[static_cast<int32>(ENeonSignificanceLOD::Medium)]);
+	SET_DWORD_STAT(STAT_NeonEnemiesLow, BucketCounts[static_cast<int32>(ENeonSignificanceLOD::Low)]);
+}
+
+/**
+ * Local players contribute their camera location; remote players (listen/dedicated server) their pawn.
+ */
+void UNeonSignificanceSubsystem::GatherViewers()
+{
+	ViewerLocations.Reset();
+	bHasLocalViewer = false;
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* Controller = It->Get();
+		if (!Controller)
+		{
+			continue;
+		}
+
+		if (Controller->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+			ViewerLocations.Add(ViewLocation);
+			bHasLocalViewer = true;
+		}
+		else if (const APawn* Pawn = Controller->GetPawn())
+		{
+			ViewerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+}
+
+/**
+ * Engaged enemies are always High. Otherwise the distance to the nearest viewer picks the bucket,
+ * and enemies nobody has rendered recently drop one bucket.
+ */
+ENeonSignificanceLOD UNeonSignificanceSubsystem::ScoreEnemy(const AEnemyCharacter* Enemy, double CurrentTime) const
+{
+	if (CurrentTime - Enemy->GetLastCombatTime() <= EngagedTime)
+	{
+		return ENeonSignificanceLOD::High;
+	}
+
+	// No viewers (e.g. a server before anyone joins) - nothing to save the detail for
+	if (ViewerLocations.Num() == 0)
+	{
+		return ENeonSignificanceLOD::Low;
+	}
+
+	const FVector EnemyLocation = Enemy->GetActorLocation();
+	double NearestDistSq = TNumericLimits<double>::Max();
+	for (const FVector& Viewer : ViewerLocations)
+	{
+		NearestDistSq = FMath::Min(NearestDistSq, FVector::DistSquared(Viewer, EnemyLocation));
+	}
+
+	// Boundaries move outwards for enemies already inside them, so they don't flap at the edge
+	const ENeonSignificanceLOD Current = Enemy->GetSignificanceLOD();
+	const float Near = NearDistance * (Current == ENeonSignificanceLOD::High ? 1.f + Hysteresis : 1.f);
+	const float Mid = MidDistance * (Current != ENeonSignificanceLOD::Low ? 1.f + Hysteresis : 1.f);
+
+	ENeonSignificanceLOD LOD = ENeonSignificanceLOD::Low;
+	if (NearestDistSq <= FMath::Square(Near))
+	{
+		LOD = ENeonSignificanceLOD::High;
+	}
+	else if (NearestDistSq <= FMath::Square(Mid))
+	{
+		LOD = ENeonSignificanceLOD::Medium;
+	}
+
+	if (bHasLocalViewer && LOD != ENeonSignificanceLOD::Low && !Enemy->WasRecentlyRendered(OffScreenTime))
+	{
+		LOD = static_cast<ENeonSignificanceLOD>(static_cast<uint8>(LOD) + 1);
+	}
+
+	return LOD;
+}
+
+TStatId UNeonSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNeonSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================
+// Lifetime
+// ========================================
+
+/**
+ * Drops all references. Enemies keep whatever rates they had; they are going away with the world.
+ */
+void UNeonSignificanceSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	ViewerLocations.Empty();
+	FMemory::Memzero(BucketCounts);
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds have enemies to score.
+ */
+bool UNeonSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
\ No newline at end of file
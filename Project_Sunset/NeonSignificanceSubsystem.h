@@ -0,0 +1,155 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonSignificanceSubsystem.generated.h"
+
+// Forward declarations
+class AEnemyCharacter;
+
+/**
+ * How much update work an enemy gets. Ordered from most to least significant.
+ */
+UENUM(BlueprintType)
+enum class ENeonSignificanceLOD : uint8
+{
+	/** Close, on screen or fighting - full rate */
+	High,
+
+	/** Mid range - reduced tick, movement and animation rates */
+	Medium,
+
+	/** Far or off screen - minimal updates, attribute events deferred */
+	Low
+};
+
+/**
+ * Update rates applied to every enemy in one significance bucket.
+ */
+USTRUCT()
+struct FNeonSignificanceBucketSettings
+{
+	GENERATED_BODY()
+
+	/** Actor tick interval (0 = every frame; only matters for Blueprint enemies that tick) */
+	UPROPERTY(Config)
+	float ActorTickInterval = 0.f;
+
+	/** UCharacterMovementComponent tick interval (0 = every frame) */
+	UPROPERTY(Config)
+	float MovementTickInterval = 0.f;
+
+	/** Skeletal mesh (animation) tick interval (0 = every frame) */
+	UPROPERTY(Config)
+	float AnimationTickInterval = 0.f;
+
+	/** Only tick the animation pose when the mesh is rendered */
+	UPROPERTY(Config)
+	bool bOnlyAnimateWhenRendered = false;
+
+	/** Hold attribute change events (UI/Blueprint) until the enemy becomes more significant */
+	UPROPERTY(Config)
+	bool bDeferAttributeEvents = false;
+};
+
+/**
+ * Scores every enemy by distance to the nearest viewer, visibility and recent combat, sorts them into
+ * High/Medium/Low buckets, and applies the bucket's update rates when an enemy changes bucket.
+ *
+ * Scoring runs a few times per second (not every frame), and settings are only touched on a bucket change,
+ * so a 200-enemy crowd costs one short loop per update plus a handful of component calls.
+ *
+ * Thresholds and bucket rates are read from the [/Script/Project_Sunset.NeonSignificanceSubsystem] section of Game.ini.
+ */
+UCLASS(Config = Game)
+class PROJECT_SUNSET_API UNeonSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UNeonSignificanceSubsystem();
+
+	/** Starts scoring an enemy (it starts in the High bucket) */
+	void RegisterEnemy(AEnemyCharacter* Enemy);
+
+	/** Stops scoring an enemy */
+	void UnregisterEnemy(AEnemyCharacter* Enemy);
+
+	/** Number of registered enemies currently in a bucket */
+	UFUNCTION(BlueprintPure, Category = "Significance")
+	int32 GetNumEnemiesInBucket(ENeonSignificanceLOD LOD) const;
+
+	/** Update rates for a bucket */
+	const FNeonSignificanceBucketSettings& GetBucketSettings(ENeonSignificanceLOD LOD) const;
+
+	// ========================================
+	// FTickableGameObject Interface
+	// ========================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// USubsystem Interface
+	// ========================================
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds have enemies to score */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// ========================================
+	// Configuration
+	// ========================================
+
+	/** Seconds between scoring passes */
+	UPROPERTY(Config)
+	float UpdateInterval = 0.25f;
+
+	/** Enemies closer than this to a viewer are High */
+	UPROPERTY(Config)
+	float NearDistance = 2000.f;
+
+	/** Enemies closer than this to a viewer are Medium (further is Low) */
+	UPROPERTY(Config)
+	float MidDistance = 5000.f;
+
+	/** Fraction a boundary is pushed out before an enemy drops to a less significant bucket (stops flapping) */
+	UPROPERTY(Config)
+	float Hysteresis = 0.1f;
+
+	/** Enemies that took damage or attacked within this many seconds are always High */
+	UPROPERTY(Config)
+	float EngagedTime = 3.f;
+
+	/** Enemies not rendered within this many seconds count as off screen (drop one bucket) */
+	UPROPERTY(Config)
+	float OffScreenTime = 0.5f;
+
+	/** Rates per bucket, indexed by ENeonSignificanceLOD */
+	UPROPERTY(Config)
+	FNeonSignificanceBucketSettings Buckets[3];
+
+private:
+	/** Collects viewer locations (local view points, or pawn locations for remote players) */
+	void GatherViewers();
+
+	/** Scores one enemy against the gathered viewers */
+	ENeonSignificanceLOD ScoreEnemy(const AEnemyCharacter* Enemy, double CurrentTime) const;
+
+	/** Registered enemies (swap-removed) */
+	TArray<TWeakObjectPtr<AEnemyCharacter>> Enemies;
+
+	/** Viewer locations for the current pass */
+	TArray<FVector> ViewerLocations;
+
+	/** Whether any viewer renders locally (dedicated servers ignore the on-screen term) */
+	bool bHasLocalViewer = false;
+
+	/** Time until the next scoring pass */
+	float TimeUntilUpdate = 0.f;
+
+	/** Enemies per bucket after the last pass */
+	int32 BucketCounts[3] = {};
+};
\ No newline at end of file
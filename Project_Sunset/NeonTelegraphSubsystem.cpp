@@ -0,0 +1,426 @@
+#include "NeonTelegraphSubsystem.h"
+#include "NeonCombatStats.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+
+// ========================================
+// Telegraphs
+// ========================================
+
+/**
+ * Mesh telegraphs take an instance from their batch; everything else takes a pooled actor.
+ */
+FNeonTelegraphHandle UNeonTelegraphSubsystem::AcquireTelegraph(const FNeonTelegraphVisual& Visual, AActor* Owner, const FTransform& RelativeTransform)
+{
+	FNeonTelegraphHandle Handle;
+
+	if (!Owner || !Visual.IsSet())
+	{
+		return Handle;
+	}
+
+	const int32 TelegraphIndex = FreeTelegraphs.Num() > 0 ? FreeTelegraphs.Pop(EAllowShrinking::No) : Telegraphs.AddDefaulted();
+	FTelegraph& Telegraph = Telegraphs[TelegraphIndex];
+
+	// Place it now so it doesn't flash at the origin for a frame
+	const FTransform WorldTransform = RelativeTransform * Owner->GetActorTransform();
+
+	if (Visual.Mesh)
+	{
+		Telegraph.BatchIndex = FindOrAddBatch(Visual.Mesh, Visual.Material);
+		Telegraph.InstanceIndex = Telegraph.BatchIndex != INDEX_NONE ? AcquireInstance(Telegraph.BatchIndex, TelegraphIndex) : INDEX_NONE;
+	}
+	else
+	{
+		Telegraph.Actor = AcquireActor(Visual.ActorClass, Owner, WorldTransform);
+	}
+
+	if (Telegraph.InstanceIndex == INDEX_NONE && !Telegraph.Actor.IsValid())
+	{
+		// World refused the spawn (tearing down)
+		Telegraph.BatchIndex = INDEX_NONE;
+		FreeTelegraphs.Add(TelegraphIndex);
+		return Handle;
+	}
+
+	Telegraph.Owner = Owner;
+	Telegraph.RelativeTransform = RelativeTransform;
+	Telegraph.bActive = true;
+	++NumActive;
+
+	// Actors already sit at WorldTransform (spawned there or placed by AcquireActor)
+	if (!Telegraph.Actor.IsValid())
+	{
+		FNeonTelegraphBatch& Batch = Batches[Telegraph.BatchIndex];
+		Batch.InstanceTransforms[Telegraph.InstanceIndex] = WorldTransform;
+		Batch.bDirty = true;
+	}
+
+	Handle.Index = TelegraphIndex;
+	Handle.Serial = Telegraph.Serial;
+	return Handle;
+}
+
+/**
+ * Releases the telegraph if the handle still refers to it, then clears the handle.
+ */
+void UNeonTelegraphSubsystem::ReleaseTelegraph(FNeonTelegraphHandle& Handle)
+{
+	if (Telegraphs.IsValidIndex(Handle.Index))
+	{
+		const FTelegraph& Telegraph = Telegraphs[Handle.Index];
+		if (Telegraph.bActive && Telegraph.Serial == Handle.Serial)
+		{
+			ReleaseSlot(Handle.Index);
+		}
+	}
+
+	Handle.Reset();
+}
+
+/**
+ * Fills the pool for a class until it holds at least Count inactive actors. Classes that aren't pooled are skipped.
+ */
+void UNeonTelegraphSubsystem::PrewarmActors(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	if (!IsPooledClass(ActorClass) || Count <= 0)
+	{
+		return;
+	}
+
+	FNeonTelegraphActorPool& Pool = ActorPools.FindOrAdd(ActorClass.Get());
+	Pool.FreeActors.Reserve(Count);
+
+	while (Pool.FreeActors.Num() < Count)
+	{
+		AActor* Actor = SpawnTelegraphActor(ActorClass, nullptr, FTransform::Identity);
+		if (!Actor)
+		{
+			break;
+		}
+
+		ParkActor(Actor);
+		Pool.FreeActors.Add(Actor);
+	}
+}
+
+/**
+ * Hands the slot's instance or actor back and bumps the serial.
+ */
+void UNeonTelegraphSubsystem::ReleaseSlot(int32 TelegraphIndex)
+{
+	FTelegraph& Telegraph = Telegraphs[TelegraphIndex];
+
+	if (Telegraph.BatchIndex != INDEX_NONE)
+	{
+		FNeonTelegraphBatch& Batch = Batches[Telegraph.BatchIndex];
+
+		// Park at zero scale - removing would shift every later instance index
+		Batch.InstanceTransforms[Telegraph.InstanceIndex] = FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+		Batch.InstanceTelegraphs[Telegraph.InstanceIndex] = INDEX_NONE;
+		Batch.FreeInstances.Add(Telegraph.InstanceIndex);
+		--Batch.NumLive;
+		Batch.bDirty = true;
+	}
+	else if (AActor* Actor = Telegraph.Actor.Get())
+	{
+		ReleaseActor(Actor);
+	}
+
+	Telegraph.Owner.Reset();
+	Telegraph.Actor.Reset();
+	Telegraph.BatchIndex = INDEX_NONE;
+	Telegraph.InstanceIndex = INDEX_NONE;
+	Telegraph.bActive = false;
+	++Telegraph.Serial;
+
+	FreeTelegraphs.Add(TelegraphIndex);
+	--NumActive;
+}
+
+// ========================================
+// Instanced Batches
+// ========================================
+
+/**
+ * Batches live on one hidden host actor spawned the first time a mesh telegraph is shown.
+ */
+int32 UNeonTelegraphSubsystem::FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+	const TPair<UStaticMesh*, UMaterialInterface*> Key(Mesh, Material);
+	if (const int32* Existing = BatchLookup.Find(Key))
+	{
+		return *Existing;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World || World->bIsTearingDown)
+	{
+		return INDEX_NONE;
+	}
+
+	if (!BatchHost)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel, AActor::StaticClass(), TEXT("NeonTelegraphBatches"));
+		SpawnParams.ObjectFlags |= RF_Transient;
+
+		BatchHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!BatchHost)
+		{
+			return INDEX_NONE;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(BatchHost, TEXT("Root"));
+		BatchHost->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(BatchHost);
+	Component->SetStaticMesh(Mesh);
+	if (Material)
+	{
+		Component->SetMaterial(0, Material);
+	}
+
+	// Purely visual - no collision, no shadows, no navigation
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetCanEverAffectNavigation(false);
+	Component->SetCastShadow(false);
+	Component->bUseAsOccluder = false;
+	Component->SetupAttachment(BatchHost->GetRootComponent());
+	Component->RegisterComponent();
+
+	const int32 BatchIndex = Batches.AddDefaulted();
+	Batches[BatchIndex].Component = Component;
+	BatchLookup.Add(Key, BatchIndex);
+
+	return BatchIndex;
+}
+
+/**
+ * Reuses a parked instance when possible; otherwise appends a new one to the component.
+ */
+int32 UNeonTelegraphSubsystem::AcquireInstance(int32 BatchIndex, int32 TelegraphIndex)
+{
+	FNeonTelegraphBatch& Batch = Batches[BatchIndex];
+	if (!Batch.Component)
+	{
+		return INDEX_NONE;
+	}
+
+	int32 InstanceIndex;
+	if (Batch.FreeInstances.Num() > 0)
+	{
+		InstanceIndex = Batch.FreeInstances.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		const FTransform Parked(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+		InstanceIndex = Batch.Component->AddInstance(Parked, true);
+		Batch.InstanceTransforms.SetNum(InstanceIndex + 1);
+		Batch.InstanceTelegraphs.SetNum(InstanceIndex + 1);
+	}
+
+	Batch.InstanceTelegraphs[InstanceIndex] = TelegraphIndex;
+	++Batch.NumLive;
+
+	return InstanceIndex;
+}
+
+// ========================================
+// Actor Pools
+// ========================================
+
+/**
+ * Only classes that implement INeonPooledTelegraph can be reset between telegraphs.
+ */
+bool UNeonTelegraphSubsystem::IsPooledClass(TSubclassOf<AActor> ActorClass)
+{
+	return ActorClass && ActorClass->ImplementsInterface(UNeonPooledTelegraph::StaticClass());
+}
+
+/**
+ * Wakes a parked pooled actor at the telegraph's transform, or spawns a new one there.
+ */
+AActor* UNeonTelegraphSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, AActor* Owner, const FTransform& WorldTransform)
+{
+	if (FNeonTelegraphActorPool* Pool = ActorPools.Find(ActorClass.Get()))
+	{
+		while (Pool->FreeActors.Num() > 0)
+		{
+			AActor* Candidate = Pool->FreeActors.Pop(EAllowShrinking::No);
+
+			// Skip anything destroyed behind our back (e.g. by a level streaming out)
+			if (!IsValid(Candidate))
+			{
+				continue;
+			}
+
+			Candidate->SetOwner(Owner);
+			Candidate->SetActorTransform(WorldTransform, false, nullptr, ETeleportType::TeleportPhysics);
+			Candidate->SetActorEnableCollision(true);
+			Candidate->SetActorHiddenInGame(false);
+			Candidate->SetActorTickEnabled(true);
+
+			INeonPooledTelegraph::Execute_OnTelegraphAcquired(Candidate);
+			return Candidate;
+		}
+	}
+
+	AActor* Actor = SpawnTelegraphActor(ActorClass, Owner, WorldTransform);
+	if (Actor && IsPooledClass(ActorClass))
+	{
+		INeonPooledTelegraph::Execute_OnTelegraphAcquired(Actor);
+	}
+
+	return Actor;
+}
+
+/**
+ * Spawned like an ability would spawn it (final transform, owned by the caster), so BeginPlay sees the real placement.
+ */
+AActor* UNeonTelegraphSubsystem::SpawnTelegraphActor(TSubclassOf<AActor> ActorClass, AActor* Owner, const FTransform& WorldTransform)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->bIsTearingDown)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Owner;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return World->SpawnActor<AActor>(ActorClass, WorldTransform, SpawnParams);
+}
+
+/**
+ * Parked actors cost nothing: not drawn, not colliding, not ticking.
+ */
+void UNeonTelegraphSubsystem::ParkActor(AActor* Actor)
+{
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->SetOwner(nullptr);
+}
+
+/**
+ * Hides the actor (it stays spawned) and returns it to its class pool.
+ * Actors whose class can't be reset are destroyed instead, so the next telegraph gets a fresh BeginPlay.
+ */
+void UNeonTelegraphSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsPooledClass(Actor->GetClass()))
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	INeonPooledTelegraph::Execute_OnTelegraphReleased(Actor);
+	ParkActor(Actor);
+
+	ActorPools.FindOrAdd(Actor->GetClass()).FreeActors.Add(Actor);
+}
+
+// ========================================
+// Per-Frame Update
+// ========================================
+
+/**
+ * Moves every telegraph to its owner, then pushes each batch's transforms in one call.
+ */
+void UNeonTelegraphSubsystem::Tick(float DeltaTime)
+{
+	NEON_COMBAT_SCOPE(STAT_NeonTelegraphUpdate);
+
+	for (int32 TelegraphIndex = 0; TelegraphIndex < Telegraphs.Num(); ++TelegraphIndex)
+	{
+		FTelegraph& Telegraph = Telegraphs[TelegraphIndex];
+		if (!Telegraph.bActive)
+		{
+			continue;
+		}
+
+		const AActor* Owner = Telegraph.Owner.Get();
+		if (!Owner)
+		{
+			// Caster died mid-telegraph
+			ReleaseSlot(TelegraphIndex);
+			continue;
+		}
+
+		const FTransform WorldTransform = Telegraph.RelativeTransform * Owner->GetActorTransform();
+
+		if (Telegraph.BatchIndex != INDEX_NONE)
+		{
+			FNeonTelegraphBatch& Batch = Batches[Telegraph.BatchIndex];
+			FTransform& InstanceTransform = Batch.InstanceTransforms[Telegraph.InstanceIndex];
+
+			if (!InstanceTransform.Equals(WorldTransform))
+			{
+				InstanceTransform = WorldTransform;
+				Batch.bDirty = true;
+			}
+		}
+		else if (AActor* Actor = Telegraph.Actor.Get())
+		{
+			Actor->SetActorTransform(WorldTransform, false, nullptr, ETeleportType::TeleportPhysics);
+		}
+		else
+		{
+			// Actor destroyed behind our back
+			ReleaseSlot(TelegraphIndex);
+		}
+	}
+
+	for (FNeonTelegraphBatch& Batch : Batches)
+	{
+		if (!Batch.bDirty || !Batch.Component)
+		{
+			continue;
+		}
+
+		// World space, mark render state dirty, teleport
+		Batch.Component->BatchUpdateInstancesTransforms(0, Batch.InstanceTransforms, true, true, true);
+		Batch.bDirty = false;
+	}
+}
+
+TStatId UNeonTelegraphSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNeonTelegraphSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================
+// Lifetime
+// ========================================
+
+/**
+ * Drops all references. The actors themselves are cleaned up with the world.
+ */
+void UNeonTelegraphSubsystem::Deinitialize()
+{
+	Telegraphs.Empty();
+	FreeTelegraphs.Empty();
+	Batches.Empty();
+	BatchLookup.Empty();
+	ActorPools.Empty();
+	BatchHost = nullptr;
+	NumActive = 0;
+
+	Super::Deinitialize();
+}
+
+/**
+ * Only game and PIE worlds show telegraphs.
+ */
+bool UNeonTelegraphSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "NeonTelegraphSubsystem.generated.h"
+
+// Forward declarations
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class UNeonPooledTelegraph : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Opts a telegraph actor class into pooling.
+ * A pooled actor is spawned once and reused, so BeginPlay only runs for its first telegraph;
+ * anything BeginPlay would set up (timelines, Niagara, material parameters) belongs in OnTelegraphAcquired instead.
+ * Actor classes without this interface are spawned per telegraph and destroyed on release.
+ */
+class PROJECT_SUNSET_API INeonPooledTelegraph
+{
+	GENERATED_BODY()
+
+public:
+	/** Called each time the pool hands the actor out, after it is placed and shown */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Telegraph")
+	void OnTelegraphAcquired();
+
+	/** Called each time the actor goes back to the pool, before it is hidden */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Telegraph")
+	void OnTelegraphReleased();
+};
+
+/**
+ * What a telegraph looks like.
+ * A mesh renders through a shared instanced component (one draw per mesh/material pair for every telegraph in the world);
+ * an actor class is the fallback for telegraphs that need more than a mesh (decals, Niagara, Blueprint logic).
+ */
+USTRUCT(BlueprintType)
+struct FNeonTelegraphVisual
+{
+	GENERATED_BODY()
+
+	/** Mesh drawn for the telegraph (takes priority over ActorClass) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Telegraph")
+	UStaticMesh* Mesh = nullptr;
+
+	/** Material override for Mesh (nullptr = mesh's own material) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Telegraph")
+	UMaterialInterface* Material = nullptr;
+
+	/** Actor spawned when no mesh is set (pooled if it implements INeonPooledTelegraph) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Telegraph")
+	TSubclassOf<AActor> ActorClass;
+
+	bool IsSet() const { return Mesh || ActorClass; }
+};
+
+/**
+ * Identifies a live telegraph. The serial catches handles kept around after their telegraph was released.
+ */
+struct FNeonTelegraphHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Serial = 0; }
+};
+
+/**
+ * One instanced component drawing every telegraph that shares a mesh/material pair.
+ * Released instances are parked at zero scale and reused, so instance indices never shift.
+ */
+USTRUCT()
+struct FNeonTelegraphBatch
+{
+	GENERATED_BODY()
+
+	/** Component owning the instances */
+	UPROPERTY()
+	UInstancedStaticMeshComponent* Component = nullptr;
+
+	/** World transform of every instance, pushed to the component in one call */
+	TArray<FTransform> InstanceTransforms;
+
+	/** Telegraph slot using each instance (INDEX_NONE = parked) */
+	TArray<int32> InstanceTelegraphs;
+
+	/** Parked instances waiting to be reused */
+	TArray<int32> FreeInstances;
+
+	/** Number of instances in use */
+	int32 NumLive = 0;
+
+	/** Transforms changed since the last push (a telegraph was released or its owner moved) */
+	bool bDirty = false;
+};
+
+/**
+ * Inactive telegraph actors for one class.
+ */
+USTRUCT()
+struct FNeonTelegraphActorPool
+{
+	GENERATED_BODY()
+
+	/** Hidden telegraph actors waiting to be handed out again */
+	UPROPERTY()
+	TArray<AActor*> FreeActors;
+};
+
+/**
+ * World subsystem that owns every ability telegraph.
+ *
+ * Instead of spawning an actor per telegraph and attaching it to the caster:
+ * - Mesh telegraphs are instances of one UInstancedStaticMeshComponent per mesh/material pair
+ * - Actor telegraphs implementing INeonPooledTelegraph come from a per-class pool and are hidden (not destroyed) when released;
+ *   other actor classes are spawned and destroyed per telegraph so their BeginPlay still runs every time
+ * - Once per frame, every telegraph is moved to its owner's transform in bulk (one batch update per component)
+ *
+ * Telegraphs whose owner is destroyed are released automatically.
+ */
+UCLASS()
+class PROJECT_SUNSET_API UNeonTelegraphSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Shows a telegraph that follows an actor.
+	 *
+	 * @param Visual - Mesh or actor class to show
+	 * @param Owner - Actor the telegraph follows
+	 * @param RelativeTransform - Offset/rotation/scale relative to the owner
+	 * @return Handle for ReleaseTelegraph (invalid if nothing could be shown)
+	 */
+	FNeonTelegraphHandle AcquireTelegraph(const FNeonTelegraphVisual& Visual, AActor* Owner, const FTransform& RelativeTransform);
+
+	/** Hides a telegraph and returns its instance/actor to the pool. Stale handles are ignored. */
+	void ReleaseTelegraph(FNeonTelegraphHandle& Handle);
+
+	/**
+	 * Spawns telegraph actors up front so later telegraphs never hit SpawnActor.
+	 *
+	 * @param ActorClass - Telegraph actor class to pre-allocate (ignored unless it implements INeonPooledTelegraph)
+	 * @param Count - Number of inactive actors the pool should hold after this call
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Telegraph")
+	void PrewarmActors(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	/** Number of telegraphs currently shown */
+	UFUNCTION(BlueprintPure, Category = "Telegraph")
+	int32 GetNumActiveTelegraphs() const { return NumActive; }
+
+	// ========================================
+	// FTickableGameObject Interface
+	// ========================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================
+	// USubsystem Interface
+	// ========================================
+
+	virtual void Deinitialize() override;
+
+protected:
+	/** Only game and PIE worlds show telegraphs */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** A live (or free) telegraph slot */
+	struct FTelegraph
+	{
+		/** Actor the telegraph follows */
+		TWeakObjectPtr<AActor> Owner;
+
+		/** Transform relative to the owner */
+		FTransform RelativeTransform;
+
+		/** Batch and instance drawing the telegraph (INDEX_NONE for actor telegraphs) */
+		int32 BatchIndex = INDEX_NONE;
+		int32 InstanceIndex = INDEX_NONE;
+
+		/** Pooled actor drawing the telegraph (actor telegraphs only) */
+		TWeakObjectPtr<AActor> Actor;
+
+		/** Bumped on release so stale handles don't release the next user of the slot */
+		uint32 Serial = 0;
+
+		bool bActive = false;
+	};
+
+	/** Finds (or creates) the batch for a mesh/material pair */
+	int32 FindOrAddBatch(UStaticMesh* Mesh, UMaterialInterface* Material);
+
+	/** Takes a parked instance from a batch (or grows it by one) */
+	int32 AcquireInstance(int32 BatchIndex, int32 TelegraphIndex);
+
+	/** Whether actors of this class are reused through the pool */
+	static bool IsPooledClass(TSubclassOf<AActor> ActorClass);
+
+	/** Takes an actor from the class pool (or spawns one), placed at WorldTransform and owned by Owner */
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, AActor* Owner, const FTransform& WorldTransform);
+
+	/** Spawns a telegraph actor at its final transform, owned by the caster */
+	AActor* SpawnTelegraphActor(TSubclassOf<AActor> ActorClass, AActor* Owner, const FTransform& WorldTransform);
+
+	/** Hides a pooled actor and turns off its collision and tick while it waits in the pool */
+	void ParkActor(AActor* Actor);
+
+	/** Hides an actor and puts it back in its class pool (destroys it if its class isn't pooled) */
+	void ReleaseActor(AActor* Actor);
+
+	/** Returns a slot's instance/actor and frees the slot */
+	void ReleaseSlot(int32 TelegraphIndex);
+
+	/** Actor holding the instanced components (spawned on first use) */
+	UPROPERTY()
+	AActor* BatchHost = nullptr;
+
+	/** One batch per mesh/material pair */
+	UPROPERTY()
+	TArray<FNeonTelegraphBatch> Batches;
+
+	/** Mesh/material pair -> index into Batches */
+	TMap<TPair<UStaticMesh*, UMaterialInterface*>, int32> BatchLookup;
+
+	/** Inactive telegraph actors keyed by their exact class */
+	UPROPERTY()
+	TMap<UClass*, FNeonTelegraphActorPool> ActorPools;
+
+	/** Telegraph slots (index = handle index) */
+	TArray<FTelegraph> Telegraphs;
+
+	/** Unused entries in Telegraphs */
+	TArray<int32> FreeTelegraphs;
+
+	/** Number of active slots in Telegraphs */
+	int32 NumActive = 0;
+};
\ No newline at end of file
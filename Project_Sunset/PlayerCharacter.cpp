@@ -8,13 +8,23 @@
 #include "EnhancedInputSubsystems.h"
 #include "Engine/LocalPlayer.h"
 #include "GameFramework/SpringArmComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "NeonCombatPawnRegistry.h"
+#include "NeonCombatLog.h"
+#include "NeonAssetPreloadSubsystem.h"
+#include "NeonPreloadManifest.h"
+#include "NeonAttributeEventSubsystem.h"
+#include "NeonReplaySubsystem.h"
+#include "NeonDamageExecCalculation.h"
 
 /**
  * Constructor - Initializes all components and default values.
  */
 APlayerCharacter::APlayerCharacter()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Nothing per-frame here - attribute UI is flushed by UNeonAttributeEventSubsystem.
+	// Blueprint children that implement Event Tick get ticking re-enabled by the Blueprint compiler.
+	PrimaryActorTick.bCanEverTick = false;
 
 	// ========================================
 	// Camera Setup
@@ -42,10 +52,36 @@ APlayerCharacter::APlayerCharacter()
 	// ========================================
 	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
 	AbilitySystemComponent->SetIsReplicated(true); // Enable for multiplayer
+	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed); // Full effects to the owner only
 	
 	Attributes = CreateDefaultSubobject<UNeonAttributeSet>(TEXT("Attributes"));
 }
 
+/**
+ * Kicks off the async preload of the character's manifest and attribute effect.
+ * Runs before BeginPlay/possession so streaming overlaps the rest of the spawn.
+ */
+void APlayerCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	UWorld* World = GetWorld();
+	UNeonAssetPreloadSubsystem* Preloader = World ? World->GetSubsystem<UNeonAssetPreloadSubsystem>() : nullptr;
+	if (!Preloader)
+	{
+		// Editor previews and other non-game worlds don't stream
+		HandleCombatAssetsReady();
+		return;
+	}
+
+	TArray<FSoftObjectPath> ExtraAssets;
+	ExtraAssets.Add(DefaultAttributeEffect.ToSoftObjectPath());
+	GetDefault<UNeonDamageExecCalculation>()->GetPreloadAssets(ExtraAssets);
+
+	Preloader->PreloadAssets(PreloadManifest, MoveTemp(ExtraAssets), 
+		FSimpleDelegate::CreateUObject(this, &APlayerCharacter::HandleCombatAssetsReady));
+}
+
 /**
  * Called when the character spawns.
  * Sets up GAS bindings and attribute change notifications.
@@ -54,7 +90,7 @@ void APlayerCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
-	UE_LOG(LogTemp, Error, TEXT("=== PlayerCharacter::BeginPlay START for %s ==="), *GetName());
+	NEON_COMBAT_VERBOSE(TEXT("PlayerCharacter::BeginPlay START for %s"), *GetName());
 
 	if (AbilitySystemComponent)
 	{
@@ -63,51 +99,85 @@ void APlayerCharacter::BeginPlay()
 
 		if (Attributes)
 		{
-			UE_LOG(LogTemp, Error, TEXT("PlayerCharacter: Attributes found, setting up bindings..."));
-			
 			// ========================================
 			// Bind Attribute Change Delegates
 			// ========================================
 			// These fire whenever an attribute value changes through GAS
 			
-			// Health changes → OnHealthChangedNative → OnHealthChanged (Blueprint)
+			// Each value and its max mark the same dirty bit; the UI hears about them
+			// once per frame through OnAttributesChanged (Blueprint)
+			
+			// Health / MaxHealth → OnHealthChangedNative
 			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
 				Attributes->GetHealthAttribute()
 			).AddUObject(this, &APlayerCharacter::OnHealthChangedNative);
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
+				Attributes->GetMaxHealthAttribute()
+			).AddUObject(this, &APlayerCharacter::OnHealthChangedNative);
 			
-			// Neon changes → OnNeonChangedNative → OnNeonChanged (Blueprint)
+			// Neon / MaxNeon → OnNeonChangedNative
 			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
 				Attributes->GetNeonAttribute()
 			).AddUObject(this, &APlayerCharacter::OnNeonChangedNative);
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
+				Attributes->GetMaxNeonAttribute()
+			).AddUObject(this, &APlayerCharacter::OnNeonChangedNative);
 			
-			// Stamina changes → OnStaminaChangedNative → OnStaminaChanged (Blueprint)
+			// Stamina / MaxStamina → OnStaminaChangedNative
 			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
 				Attributes->GetStaminaAttribute()
 			).AddUObject(this, &APlayerCharacter::OnStaminaChangedNative);
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
+				Attributes->GetMaxStaminaAttribute()
+			).AddUObject(this, &APlayerCharacter::OnStaminaChangedNative);
 			
-			// Ultimate Charge changes → OnUltimateChargeChangedNative → OnUltimateChargeChanged (Blueprint)
+			// Ultimate Charge / Max → OnUltimateChargeChangedNative
 			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
 				Attributes->GetUltimateChargeAttribute()
 			).AddUObject(this, &APlayerCharacter::OnUltimateChargeChangedNative);
+			AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(
+				Attributes->GetMaxUltimateChargeAttribute()
+			).AddUObject(this, &APlayerCharacter::OnUltimateChargeChangedNative);
 			
 			// ========================================
 			// Bind Damage Delegate
 			// ========================================
-			// This fires when damage is dealt (from PostGameplayEffectExecute)
-			Attributes->OnDamageTaken.AddDynamic(this, &APlayerCharacter::HandleDamageTaken);
-			UE_LOG(LogTemp, Error, TEXT("PlayerCharacter: BOUND to OnDamageTaken delegate!"));
+			// This fires when damage is dealt to this character (from PostGameplayEffectExecute)
+			Attributes->OnDamageTakenNative.AddUObject(this, &APlayerCharacter::HandleDamageTaken);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("PlayerCharacter: ERROR - Attributes is NULL!"));
+			NEON_COMBAT_LOG(Error, TEXT("PlayerCharacter %s: Attributes is NULL!"), *GetName());
 		}
+
+		// Combat replay: abilities and effects (no-ops unless a replay is recording or playing)
+		AbilitySystemComponent->AbilityActivatedCallbacks.AddUObject(this, &APlayerCharacter::HandleAbilityActivated);
+		AbilitySystemComponent->OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &APlayerCharacter::HandleEffectAppliedToSelf);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("PlayerCharacter: ERROR - AbilitySystemComponent is NULL!"));
+		NEON_COMBAT_LOG(Error, TEXT("PlayerCharacter %s: AbilitySystemComponent is NULL!"), *GetName());
 	}
 	
-	UE_LOG(LogTemp, Error, TEXT("=== PlayerCharacter::BeginPlay COMPLETE ==="));
+	// Make this character visible to combat queries (projectile hit detection, AOEs)
+	if (UNeonCombatPawnRegistry* Registry = GetWorld()->GetSubsystem<UNeonCombatPawnRegistry>())
+	{
+		Registry->RegisterPawn(this);
+	}
+}
+
+/**
+ * Called when the character is removed from the world.
+ * Removes it from combat queries.
+ */
+void APlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UNeonCombatPawnRegistry* Registry = GetWorld()->GetSubsystem<UNeonCombatPawnRegistry>())
+	{
+		Registry->UnregisterPawn(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 /**
@@ -117,18 +187,28 @@ void APlayerCharacter::BeginPlay()
 void APlayerCharacter::InitializeAttributes()
 {
 	// Validate we have both an ASC and a Gameplay Effect to apply
-	if (!AbilitySystemComponent || !DefaultAttributeEffect)
+	if (!AbilitySystemComponent || DefaultAttributeEffect.IsNull())
 	{
 		return;
 	}
 
+	// Still streaming - HandleCombatAssetsReady applies it once loaded
+	const TSubclassOf<UGameplayEffect> AttributeEffect = DefaultAttributeEffect.Get();
+	if (!AttributeEffect)
+	{
+		bAttributeInitPending = true;
+		return;
+	}
+
+	bAttributeInitPending = false;
+
 	// Create effect context (who is applying this effect)
 	FGameplayEffectContextHandle ContextHandle = AbilitySystemComponent->MakeEffectContext();
 	ContextHandle.AddSourceObject(this);
 
 	// Create the effect specification (the "instruction manual")
 	FGameplayEffectSpecHandle SpecHandle = 
-		AbilitySystemComponent->MakeOutgoingSpec(DefaultAttributeEffect, 1.0f, ContextHandle);
+		AbilitySystemComponent->MakeOutgoingSpec(AttributeEffect, 1.0f, ContextHandle);
 
 	// Apply the effect to ourselves
 	if (SpecHandle.IsValid())
@@ -141,47 +221,171 @@ void APlayerCharacter::InitializeAttributes()
 }
 
 /**
- * Native callback for Health changes.
- * Routes to Blueprint event with both current and max values.
+ * Everything the character needs is resident from here on.
+ */
+void APlayerCharacter::HandleCombatAssetsReady()
+{
+	if (bCombatAssetsReady)
+	{
+		return;
+	}
+
+	bCombatAssetsReady = true;
+
+	if (bAttributeInitPending)
+	{
+		InitializeAttributes();
+	}
+
+	// Bake the combo lookup now rather than on the first hit
+	GetDefault<UNeonDamageExecCalculation>()->GetComboLookup(this);
+
+	NEON_COMBAT_VERBOSE(TEXT("PlayerCharacter %s: combat assets ready"), *GetName());
+
+	OnCombatAssetsReady.Broadcast();
+}
+
+/** Bits in APlayerCharacter::DirtyAttributes (a value and its max share a bit) */
+enum ENeonAttributeDirtyFlags : uint8
+{
+	NeonAttr_Health = 1 << 0,
+	NeonAttr_Neon = 1 << 1,
+	NeonAttr_Stamina = 1 << 2,
+	NeonAttr_UltimateCharge = 1 << 3,
+};
+
+/**
+ * Resuming queues a flush for everything that changed while events were held.
+ */
+void APlayerCharacter::SetAttributeEventsDeferred(bool bDeferred)
+{
+	if (bAttributeEventsDeferred == bDeferred)
+	{
+		return;
+	}
+
+	bAttributeEventsDeferred = bDeferred;
+
+	if (!bDeferred)
+	{
+		MarkAttributesDirty(0);
+	}
+}
+
+/**
+ * First change of the frame queues the character; later changes only set bits.
+ */
+void APlayerCharacter::MarkAttributesDirty(uint8 AttributeBits)
+{
+	DirtyAttributes |= AttributeBits;
+
+	if (DirtyAttributes == 0 || bAttributeEventsDeferred || bAttributeFlushQueued)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (UNeonAttributeEventSubsystem* AttributeEvents = World ? World->GetSubsystem<UNeonAttributeEventSubsystem>() : nullptr)
+	{
+		bAttributeFlushQueued = true;
+		AttributeEvents->QueueFlush(this);
+	}
+	else
+	{
+		// No aggregator (non-game world) - deliver immediately
+		FlushAttributeEvents();
+	}
+}
+
+/**
+ * Reads every value straight from the attribute set (no ASC lookups) and sends one event.
+ */
+void APlayerCharacter::FlushAttributeEvents()
+{
+	bAttributeFlushQueued = false;
+
+	if (bAttributeEventsDeferred || DirtyAttributes == 0 || !Attributes)
+	{
+		return;
+	}
+
+	FNeonAttributeSnapshot Snapshot;
+	Snapshot.Health = Attributes->GetHealth();
+	Snapshot.MaxHealth = Attributes->GetMaxHealth();
+	Snapshot.Neon = Attributes->GetNeon();
+	Snapshot.MaxNeon = Attributes->GetMaxNeon();
+	Snapshot.Stamina = Attributes->GetStamina();
+	Snapshot.MaxStamina = Attributes->GetMaxStamina();
+	Snapshot.UltimateCharge = Attributes->GetUltimateCharge();
+	Snapshot.MaxUltimateCharge = Attributes->GetMaxUltimateCharge();
+	Snapshot.bHealthChanged = (DirtyAttributes & NeonAttr_Health) != 0;
+	Snapshot.bNeonChanged = (DirtyAttributes & NeonAttr_Neon) != 0;
+	Snapshot.bStaminaChanged = (DirtyAttributes & NeonAttr_Stamina) != 0;
+	Snapshot.bUltimateChargeChanged = (DirtyAttributes & NeonAttr_UltimateCharge) != 0;
+
+	DirtyAttributes = 0;
+
+	OnAttributesChanged(Snapshot);
+}
+
+/**
+ * Default routing for Blueprints that still use the per-attribute events.
+ * Each changed attribute fires its event once per frame with the end-of-frame value.
+ */
+void APlayerCharacter::OnAttributesChanged_Implementation(const FNeonAttributeSnapshot& Snapshot)
+{
+	if (Snapshot.bHealthChanged)
+	{
+		OnHealthChanged(Snapshot.Health, Snapshot.MaxHealth);
+	}
+	if (Snapshot.bNeonChanged)
+	{
+		OnNeonChanged(Snapshot.Neon, Snapshot.MaxNeon);
+	}
+	if (Snapshot.bStaminaChanged)
+	{
+		OnStaminaChanged(Snapshot.Stamina, Snapshot.MaxStamina);
+	}
+	if (Snapshot.bUltimateChargeChanged)
+	{
+		OnUltimateChargeChanged(Snapshot.UltimateCharge, Snapshot.MaxUltimateCharge);
+	}
+}
+
+/**
+ * Native callback for Health and MaxHealth changes.
+ * Only marks Health dirty; the Blueprint event goes out with the end-of-frame flush.
  */
 void APlayerCharacter::OnHealthChangedNative(const FOnAttributeChangeData& Data)
 {
-	float NewValue = Data.NewValue;
-	float MaxValue = AbilitySystemComponent->GetNumericAttribute(Attributes->GetMaxHealthAttribute());
-	OnHealthChanged(NewValue, MaxValue);
+	MarkAttributesDirty(NeonAttr_Health);
 }
 
 /**
- * Native callback for Neon changes.
- * Routes to Blueprint event with both current and max values.
+ * Native callback for Neon and MaxNeon changes.
+ * Only marks Neon dirty; the Blueprint event goes out with the end-of-frame flush.
  */
 void APlayerCharacter::OnNeonChangedNative(const FOnAttributeChangeData& Data)
 {
-	float NewValue = Data.NewValue;
-	float MaxValue = AbilitySystemComponent->GetNumericAttribute(Attributes->GetMaxNeonAttribute());
-	OnNeonChanged(NewValue, MaxValue);
+	MarkAttributesDirty(NeonAttr_Neon);
 }
 
 /**
- * Native callback for Stamina changes.
- * Routes to Blueprint event with both current and max values.
+ * Native callback for Stamina and MaxStamina changes.
+ * Regen changes Stamina every tick - this keeps it to one Blueprint call per frame.
  */
 void APlayerCharacter::OnStaminaChangedNative(const FOnAttributeChangeData& Data)
 {
-	float NewValue = Data.NewValue;
-	float MaxValue = AbilitySystemComponent->GetNumericAttribute(Attributes->GetMaxStaminaAttribute());
-	OnStaminaChanged(NewValue, MaxValue);
+	MarkAttributesDirty(NeonAttr_Stamina);
 }
 
 /**
- * Native callback for Ultimate Charge changes.
- * Routes to Blueprint event with both current and max values.
+ * Native callback for Ultimate Charge and its max.
+ * Only marks it dirty; the Blueprint event goes out with the end-of-frame flush.
  */
 void APlayerCharacter::OnUltimateChargeChangedNative(const FOnAttributeChangeData& Data)
 {
-	float NewValue = Data.NewValue;
-	float MaxValue = AbilitySystemComponent->GetNumericAttribute(Attributes->GetMaxUltimateChargeAttribute());
-	OnUltimateChargeChanged(NewValue, MaxValue);
+	MarkAttributesDirty(NeonAttr_UltimateCharge);
 }
 
 /**
@@ -189,12 +393,11 @@ void APlayerCharacter::OnUltimateChargeChangedNative(const FOnAttributeChangeDat
  * PlayerCharacter does nothing (player damage is handled in Blueprint).
  * EnemyCharacter overrides this for AI reactions.
  */
-void APlayerCharacter::HandleDamageTaken(float DamageAmount, AActor* DamagedActor)
+void APlayerCharacter::HandleDamageTaken(const FNeonDamageEvent& Event)
 {
-	UE_LOG(LogTemp, Error, TEXT("=== PlayerCharacter::HandleDamageTaken CALLED ==="));
-	UE_LOG(LogTemp, Error, TEXT("DamageAmount: %.1f, DamagedActor: %s, This: %s"), 
-		DamageAmount, 
-		DamagedActor ? *DamagedActor->GetName() : TEXT("NULL"), 
+	NEON_COMBAT_VERBOSE(TEXT("PlayerCharacter::HandleDamageTaken - DamageAmount: %.1f, Instigator: %s, This: %s"), 
+		Event.Amount, 
+		*GetNameSafe(Event.Instigator), 
 		*GetName());
 	
 	// Base implementation - intentionally empty
@@ -202,6 +405,75 @@ void APlayerCharacter::HandleDamageTaken(float DamageAmount, AActor* DamagedActo
 	// Enemy damage reactions override this function
 }
 
+/**
+ * Recorded as an input: playback re-activates the same ability class.
+ * AI activations and triggered abilities are skipped - during playback the AI and the triggers start them again
+ * on their own, so recording them would activate them twice.
+ */
+void APlayerCharacter::HandleAbilityActivated(UGameplayAbility* Ability)
+{
+	if (!IsPlayerControlled())
+	{
+		return;
+	}
+
+	UNeonReplaySubsystem* Replay = GetActiveReplay();
+	if (Replay && !IsTriggeredAbility(Ability))
+	{
+		Replay->RecordAbilityActivated(this, Ability);
+	}
+}
+
+/**
+ * Looks the ability's spec up in the ASC's trigger tables (filled from each ability's AbilityTriggers when granted).
+ */
+bool APlayerCharacter::IsTriggeredAbility(const UGameplayAbility* Ability) const
+{
+	const FGameplayAbilitySpecHandle SpecHandle = Ability ? Ability->GetCurrentAbilitySpecHandle() : FGameplayAbilitySpecHandle();
+	if (!SpecHandle.IsValid() || !AbilitySystemComponent)
+	{
+		return false;
+	}
+
+	for (const TPair<FGameplayTag, TArray<FGameplayAbilitySpecHandle>>& Trigger : AbilitySystemComponent->GameplayEventTriggeredAbilities)
+	{
+		if (Trigger.Value.Contains(SpecHandle))
+		{
+			return true;
+		}
+	}
+
+	for (const TPair<FGameplayTag, TArray<FGameplayAbilitySpecHandle>>& Trigger : AbilitySystemComponent->OwnedTagTriggeredAbilities)
+	{
+		if (Trigger.Value.Contains(SpecHandle))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * Recorded as a result: playback checks the same effects land again.
+ */
+void APlayerCharacter::HandleEffectAppliedToSelf(UAbilitySystemComponent* Source, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	if (UNeonReplaySubsystem* Replay = GetActiveReplay())
+	{
+		Replay->RecordEffectApplied(Spec.GetContext().GetInstigator(), this, Spec);
+	}
+}
+
+/**
+ * Null unless recording or playing back, so the input handlers stay a lookup and a compare.
+ */
+UNeonReplaySubsystem* APlayerCharacter::GetActiveReplay() const
+{
+	UNeonReplaySubsystem* Replay = GetWorld()->GetSubsystem<UNeonReplaySubsystem>();
+	return Replay && Replay->GetMode() != ENeonReplayMode::None ? Replay : nullptr;
+}
+
 /**
  * Called when a controller possesses this character.
  * Initializes GAS and sets up Enhanced Input.
@@ -301,6 +573,11 @@ void APlayerCharacter::Move(const FInputActionValue& Value)
 		AddMovementInput(ForwardDirection, MovementVector.Y); // Forward/Backward
 		AddMovementInput(RightDirection, MovementVector.X);   // Left/Right
 	}
+
+	if (UNeonReplaySubsystem* Replay = GetActiveReplay())
+	{
+		Replay->RecordMove(this, MovementVector);
+	}
 }
 
 /**
@@ -315,6 +592,11 @@ void APlayerCharacter::Look(const FInputActionValue& Value)
 		AddControllerYawInput(LookAxisVector.X);   // Horizontal rotation
 		AddControllerPitchInput(LookAxisVector.Y); // Vertical rotation
 	}
+
+	if (UNeonReplaySubsystem* Replay = GetActiveReplay())
+	{
+		Replay->RecordLook(this, LookAxisVector);
+	}
 }
 
 /**
@@ -326,6 +608,11 @@ void APlayerCharacter::StartSprint()
 	{
 		GetCharacterMovement()->MaxWalkSpeed = 600.f; // Sprint speed
 	}
+
+	if (UNeonReplaySubsystem* Replay = GetActiveReplay())
+	{
+		Replay->RecordSprint(this, true);
+	}
 }
 
 /**
@@ -337,6 +624,11 @@ void APlayerCharacter::StopSprint()
 	{
 		GetCharacterMovement()->MaxWalkSpeed = 300.f; // Walk speed
 	}
+
+	if (UNeonReplaySubsystem* Replay = GetActiveReplay())
+	{
+		Replay->RecordSprint(this, false);
+	}
 }
 
 /**
@@ -346,12 +638,4 @@ void APlayerCharacter::StopSprint()
 UAbilitySystemComponent* APlayerCharacter::GetAbilitySystemComponent() const
 {
 	return AbilitySystemComponent;
-}
-
-/**
- * Called every frame.
- */
-void APlayerCharacter::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
 }
\ No newline at end of file
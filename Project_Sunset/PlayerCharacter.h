@@ -16,6 +16,64 @@ class UAbilitySystemComponent;
 class UNeonAttributeSet;
 class UInputMappingContext;
 class UInputAction;
+class UNeonPreloadManifest;
+class UNeonReplaySubsystem;
+class UGameplayAbility;
+
+/**
+ * Delegate that broadcasts once a character's combat assets (preload manifest, attribute effect) are loaded.
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCombatAssetsReady);
+
+/**
+ * Every UI-facing attribute at the end of a frame, plus which ones changed during it.
+ * Sent once per frame by APlayerCharacter::OnAttributesChanged.
+ */
+USTRUCT(BlueprintType)
+struct FNeonAttributeSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float Health = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float MaxHealth = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float Neon = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float MaxNeon = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float Stamina = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float MaxStamina = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float UltimateCharge = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	float MaxUltimateCharge = 0.f;
+
+	/** Health or MaxHealth changed this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	bool bHealthChanged = false;
+
+	/** Neon or MaxNeon changed this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	bool bNeonChanged = false;
+
+	/** Stamina or MaxStamina changed this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	bool bStaminaChanged = false;
+
+	/** UltimateCharge or MaxUltimateCharge changed this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "GAS")
+	bool bUltimateChargeChanged = false;
+};
 
 /**
  * Base character class implementing the Gameplay Ability System (GAS).
@@ -63,6 +121,14 @@ public:
 	// ========================================
 	// Blueprint Events (Attribute Changes)
 	// ========================================
+
+	/**
+	 * Called at most once per frame with every attribute that changed during it.
+	 * Override this in Blueprint to update all UI in one call. The default implementation
+	 * fires the individual On*Changed events below for the attributes that changed.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "GAS")
+	void OnAttributesChanged(const FNeonAttributeSnapshot& Snapshot);
 	
 	/**
 	 * Blueprint event called when Health changes.
@@ -134,16 +200,54 @@ public:
 	 */
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
 
+	/** Slot in UNeonCombatPawnRegistry, INDEX_NONE while not registered */
+	int32 GetCombatRegistryIndex() const { return CombatRegistryIndex; }
+
+	/** Generation of the registry slot when this pawn took it (tells this pawn apart from earlier users of the slot) */
+	uint32 GetCombatRegistryGeneration() const { return CombatRegistryGeneration; }
+
+	// ========================================
+	// Asset Preloading
+	// ========================================
+
+	/**
+	 * Abilities, projectiles and assets this character fights with.
+	 * Streamed asynchronously as the character spawns so nothing sync-loads mid-fight.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Preload")
+	UNeonPreloadManifest* PreloadManifest;
+
+	/** Whether everything in PreloadManifest (and DefaultAttributeEffect) has finished loading */
+	UFUNCTION(BlueprintPure, Category = "Preload")
+	bool AreCombatAssetsReady() const { return bCombatAssetsReady; }
+
+	/**
+	 * Holds attribute change events (OnAttributesChanged) past the end of the frame.
+	 * When events are resumed, everything that changed in the meantime is flushed in one event.
+	 * Used by significance LOD for enemies nobody is looking at.
+	 */
+	void SetAttributeEventsDeferred(bool bDeferred);
+
+	/** Sends OnAttributesChanged for the attributes marked dirty (called by UNeonAttributeEventSubsystem) */
+	void FlushAttributeEvents();
+
+	/** Fires once the combat assets are loaded (never fires twice; check AreCombatAssetsReady first) */
+	UPROPERTY(BlueprintAssignable, Category = "Preload")
+	FOnCombatAssetsReady OnCombatAssetsReady;
+
 protected:
+	/** Starts streaming the combat assets as soon as the character is spawned */
+	virtual void PostInitializeComponents() override;
+
 	/** Called when the game starts or when spawned */
 	virtual void BeginPlay() override;
+
+	/** Called when the character is destroyed or the level ends */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	
 	/** Called when this character is possessed by a controller */
 	virtual void PossessedBy(AController* NewController) override;
 	
-	/** Called every frame */
-	virtual void Tick(float DeltaTime) override;
-	
 	/** Sets up input bindings */
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 
@@ -163,37 +267,82 @@ protected:
 	
 	/** 
 	 * Gameplay Effect that sets initial attribute values.
-	 * Assign in Blueprint (e.g., GE_InitializeStats).
+	 * Assign in Blueprint (e.g., GE_InitializeStats). Streamed with the preload manifest.
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GAS")
-	TSubclassOf<class UGameplayEffect> DefaultAttributeEffect;
+	TSoftClassPtr<class UGameplayEffect> DefaultAttributeEffect;
 
-	/** Applies the DefaultAttributeEffect to initialize stats */
+	/** Applies the DefaultAttributeEffect to initialize stats (deferred until it has loaded) */
 	void InitializeAttributes();
 
+	/** Preload callback - applies deferred attribute initialization and broadcasts OnCombatAssetsReady */
+	void HandleCombatAssetsReady();
+
 	// ========================================
 	// Attribute Change Callbacks
 	// ========================================
 	
-	/** Native C++ callback for Health changes - routes to Blueprint event */
+	/** Native C++ callback for Health/MaxHealth changes - marks Health dirty for this frame's flush */
 	virtual void OnHealthChangedNative(const FOnAttributeChangeData& Data);
 	
-	/** Native C++ callback for Neon changes - routes to Blueprint event */
+	/** Native C++ callback for Neon/MaxNeon changes - marks Neon dirty for this frame's flush */
 	virtual void OnNeonChangedNative(const FOnAttributeChangeData& Data);
 	
-	/** Native C++ callback for Stamina changes - routes to Blueprint event */
+	/** Native C++ callback for Stamina/MaxStamina changes - marks Stamina dirty for this frame's flush */
 	virtual void OnStaminaChangedNative(const FOnAttributeChangeData& Data);
 	
-	/** Native C++ callback for Ultimate Charge changes - routes to Blueprint event */
+	/** Native C++ callback for Ultimate Charge changes - marks it dirty for this frame's flush */
 	virtual void OnUltimateChargeChangedNative(const FOnAttributeChangeData& Data);
+
+	/** Sets dirty bits and queues the end-of-frame flush (unless already queued or deferred) */
+	void MarkAttributesDirty(uint8 AttributeBits);
 	
 	/**
-	 * Called when this character takes damage.
+	 * Called when this character takes damage (bound natively to this character's own attribute set).
 	 * Virtual so EnemyCharacter can override for custom behavior.
 	 * 
-	 * @param DamageAmount - Amount of damage received
-	 * @param DamagedActor - The actor that was damaged
+	 * @param Event - The damage that was applied to this character
 	 */
-	UFUNCTION()
-	virtual void HandleDamageTaken(float DamageAmount, AActor* DamagedActor);
+	virtual void HandleDamageTaken(const FNeonDamageEvent& Event);
+
+	// ========================================
+	// Combat Replay
+	// ========================================
+
+	/** Reports an input-driven ability activation of a player-controlled character to the replay recorder */
+	void HandleAbilityActivated(UGameplayAbility* Ability);
+
+	/** Whether an ability is started by a gameplay event or owned tag trigger rather than by input */
+	bool IsTriggeredAbility(const UGameplayAbility* Ability) const;
+
+	/** Reports an effect applied to this character to the replay recorder */
+	void HandleEffectAppliedToSelf(UAbilitySystemComponent* Source, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+
+	/** World's replay subsystem while it is recording or playing back, otherwise null */
+	UNeonReplaySubsystem* GetActiveReplay() const;
+
+private:
+	/** Slot in UNeonCombatPawnRegistry (assigned by the registry) */
+	int32 CombatRegistryIndex = INDEX_NONE;
+
+	/** Generation of CombatRegistryIndex (assigned by the registry) */
+	uint32 CombatRegistryGeneration = 0;
+
+	/** Set once the preload completes */
+	bool bCombatAssetsReady = false;
+
+	/** InitializeAttributes ran before DefaultAttributeEffect finished loading */
+	bool bAttributeInitPending = false;
+
+	/** Attribute events are being held (see SetAttributeEventsDeferred) */
+	bool bAttributeEventsDeferred = false;
+
+	/** Queued with UNeonAttributeEventSubsystem for this frame's flush */
+	bool bAttributeFlushQueued = false;
+
+	/** ENeonAttributeDirtyFlags bits for attributes changed since the last flush */
+	uint8 DirtyAttributes = 0;
+
+	friend class UNeonCombatPawnRegistry;
+	friend class UNeonReplaySubsystem;
 };
\ No newline at end of file
@@ -2,5 +2,42 @@
 
 #include "Project_Sunset.h"
 #include "Modules/ModuleManager.h"
+#include "Engine/NetDriver.h"
+#include "Engine/ReplicationDriver.h"
+#include "NeonReplicationGraph.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Project_Sunset, "Project_Sunset" );
+static TAutoConsoleVariable<bool> CVarNeonReplicationGraph(
+	TEXT("neon.Net.ReplicationGraph"),
+	true,
+	TEXT("Use UNeonReplicationGraph for the game net driver (read when a net driver is created)."),
+	ECVF_Default
+);
+
+/**
+ * Game module - installs the replication graph for game net drivers.
+ */
+class FProjectSunsetModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		UReplicationDriver::CreateReplicationDriverDelegate().BindLambda(
+			[](UNetDriver* ForNetDriver, const FURL& URL, UWorld* World) -> UReplicationDriver*
+			{
+				// Beacons and demo drivers keep the default relevancy
+				if (!CVarNeonReplicationGraph.GetValueOnGameThread() || !ForNetDriver || ForNetDriver->NetDriverName != NAME_GameNetDriver)
+				{
+					return nullptr;
+				}
+
+				return NewObject<UNeonReplicationGraph>(GetTransientPackage());
+			});
+	}
+
+	virtual void ShutdownModule() override
+	{
+		UReplicationDriver::CreateReplicationDriverDelegate().Unbind();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FProjectSunsetModule, Project_Sunset, "Project_Sunset" );